@@ -118,6 +118,21 @@ enum iox_AllocationResult iox_pub_loan_aligned_chunk_with_user_header(iox_pub_t
                                                                       const uint32_t userHeaderSize,
                                                                       const uint32_t userHeaderAlignment);
 
+/// @brief allocates multiple chunks in the shared memory
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array with numberOfChunks elements in which the pointers to the user-payloads of the
+///            allocated chunks are stored
+/// @param[in] numberOfChunks number of chunks to allocate
+/// @param[in] userPayloadSize user-payload size of the allocated chunks
+/// @return on success it returns AllocationResult_SUCCESS otherwise a value which
+///         describes the error; in this case no chunk is allocated
+/// @note the number of chunks a publisher can hold simultaneously is limited by the deployment value
+///       IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY
+enum iox_AllocationResult iox_pub_loan_chunks(iox_pub_t const self,
+                                              void** const userPayloads,
+                                              const uint64_t numberOfChunks,
+                                              const uint64_t userPayloadSize);
+
 /// @brief releases ownership of a previously allocated chunk without sending it
 /// @param[in] self handle of the publisher
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be free'd
@@ -128,6 +143,13 @@ void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload);
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be send
 void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload);
 
+/// @brief sends previously allocated chunks in the order of the array; every subscriber is notified only once for all
+///        chunks
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array with the pointers to the user-payloads of the chunks which should be send
+/// @param[in] numberOfChunks number of chunks in the array
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfChunks);
+
 /// @brief offers the service
 /// @param[in] self handle of the publisher
 void iox_pub_offer(iox_pub_t const self);
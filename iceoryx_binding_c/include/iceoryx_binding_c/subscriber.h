@@ -107,7 +107,21 @@ enum iox_SubscribeState iox_sub_get_subscription_state(iox_sub_t const self);
 ///         an enum which describes the error
 enum iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** const userPayload);
 
-/// @brief release a previously acquired chunk (via iox_sub_take_chunk)
+/// @brief retrieve multiple received chunks at once
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads array with maxNumberOfChunks elements in which the pointers to the user-payloads of the
+///            received chunks are stored in the order of their arrival
+/// @param[in] maxNumberOfChunks maximum number of chunks to retrieve
+/// @param[in] numberOfChunks pointer in which the number of retrieved chunks is stored
+/// @return if at least one chunk could be received it returns ChunkReceiveResult_SUCCESS otherwise
+///         an enum which describes the error
+/// @note every retrieved chunk must be released with iox_sub_release_chunk
+enum iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                                const void** const userPayloads,
+                                                const uint64_t maxNumberOfChunks,
+                                                uint64_t* const numberOfChunks);
+
+/// @brief release a previously acquired chunk (via iox_sub_take_chunk or iox_sub_take_chunks)
 /// @param[in] self handle to the subscriber
 /// @param[in] userPayload pointer to the user-payload of chunk which should be released
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload);
@@ -24,6 +24,8 @@
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/assertions.hpp"
 #include "iox/logging.hpp"
+#include "iox/span.hpp"
+#include "iox/vector.hpp"
 
 using namespace iox;
 using namespace iox::popo;
@@ -109,7 +111,7 @@ void iox_pub_deinit(iox_pub_t const self)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
 
-    self->m_portData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    PublisherPortUser(self->m_portData).destroy();
     delete self;
 }
 
@@ -154,6 +156,44 @@ iox_AllocationResult iox_pub_loan_aligned_chunk_with_user_header(iox_pub_t const
     return AllocationResult_SUCCESS;
 }
 
+iox_AllocationResult iox_pub_loan_chunks(iox_pub_t const self,
+                                         void** const userPayloads,
+                                         const uint64_t numberOfChunks,
+                                         const uint64_t userPayloadSize)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(userPayloads != nullptr || numberOfChunks == 0U, "'userPayloads' must not be a 'nullptr'");
+
+    if (numberOfChunks > MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY)
+    {
+        return AllocationResult_TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL;
+    }
+
+    PublisherPortUser publisher(self->m_portData);
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        auto result = publisher.tryAllocateChunk(userPayloadSize,
+                                                 IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                                 IOX_C_CHUNK_NO_USER_HEADER_SIZE,
+                                                 IOX_C_CHUNK_NO_USER_HEADER_ALIGNMENT);
+        if (result.has_error())
+        {
+            for (uint64_t j = 0U; j < i; ++j)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) C API with array and size
+                publisher.releaseChunk(ChunkHeader::fromUserPayload(userPayloads[j]));
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) C API with array and size
+                userPayloads[j] = nullptr;
+            }
+            return cpp2c::allocationResult(result.error());
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) C API with array and size
+        userPayloads[i] = result.value()->userPayload();
+    }
+
+    return AllocationResult_SUCCESS;
+}
+
 void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -168,6 +208,32 @@ void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload)
     PublisherPortUser(self->m_portData).sendChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfChunks)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(userPayloads != nullptr || numberOfChunks == 0U, "'userPayloads' must not be a 'nullptr'");
+
+    PublisherPortUser publisher(self->m_portData);
+    vector<ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            publisher.sendChunks(span<ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+            chunkHeaders.clear();
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) C API with array and size
+        void* const userPayload = userPayloads[i];
+        IOX_ENFORCE(userPayload != nullptr, "'userPayloads' must not contain a 'nullptr'");
+        chunkHeaders.emplace_back(ChunkHeader::fromUserPayload(userPayload));
+    }
+
+    if (!chunkHeaders.empty())
+    {
+        publisher.sendChunks(span<ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+    }
+}
+
 void iox_pub_offer(iox_pub_t const self)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -24,8 +24,11 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/assertions.hpp"
 #include "iox/logging.hpp"
+#include "iox/span.hpp"
+#include "iox/vector.hpp"
 
 using namespace iox;
 using namespace iox::popo;
@@ -165,6 +168,35 @@ iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** con
     return ChunkReceiveResult_SUCCESS;
 }
 
+iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                           const void** const userPayloads,
+                                           const uint64_t maxNumberOfChunks,
+                                           uint64_t* const numberOfChunks)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(userPayloads != nullptr || maxNumberOfChunks == 0U, "'userPayloads' must not be a 'nullptr'");
+    IOX_ENFORCE(numberOfChunks != nullptr, "'numberOfChunks' must not be a 'nullptr'");
+
+    *numberOfChunks = 0U;
+
+    vector<const ChunkHeader*, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY> chunkHeaders;
+    chunkHeaders.resize(algorithm::minVal(maxNumberOfChunks, chunkHeaders.capacity()));
+
+    auto result = SubscriberPortUser(self->m_portData).tryGetChunks(span<const ChunkHeader*>(chunkHeaders));
+    if (result.has_error())
+    {
+        return cpp2c::chunkReceiveResult(result.error());
+    }
+
+    for (uint64_t i = 0U; i < result.value(); ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) C API with array and size
+        userPayloads[i] = chunkHeaders[i]->userPayload();
+    }
+    *numberOfChunks = result.value();
+    return ChunkReceiveResult_SUCCESS;
+}
+
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -870,7 +870,10 @@ TEST_F(iox_listener_test, AttachingServiceDiscoveryWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "75fd4e6f-ee2f-4e28-a2d8-8a0f01dbd91c");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_subscriberPortData[0]));
+    // the first subscriber of the service discovery receives the snapshots and the second one the deltas
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_subscriberPortData[1]))
+        .WillOnce(Return(&m_subscriberPortData[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -890,7 +893,9 @@ TEST_F(iox_listener_test, AttachingServiceDiscoveryWithContextDataWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2d7cbe60-bda1-4191-b2d5-d67c47312a48");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_subscriberPortData[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_subscriberPortData[1]))
+        .WillOnce(Return(&m_subscriberPortData[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
     uint64_t someContextData = 0U;
@@ -914,7 +919,9 @@ TEST_F(iox_listener_test, AttachingServiceDiscoveryWithNullptrFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6015de0d-6197-4f53-b9c2-f7f8be9f4b7e");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_subscriberPortData[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_subscriberPortData[1]))
+        .WillOnce(Return(&m_subscriberPortData[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -945,7 +952,9 @@ TEST_F(iox_listener_test, AttachingServiceDiscoveryWithContextDataWithNullptrFai
 {
     ::testing::Test::RecordProperty("TEST_ID", "3f3d6be8-df3c-40a5-ac3d-b88189afbd30");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_subscriberPortData[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_subscriberPortData[1]))
+        .WillOnce(Return(&m_subscriberPortData[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
     uint64_t someContextData = 0U;
@@ -1000,7 +1009,9 @@ TEST_F(iox_listener_test, DettachingListenerServiceDiscoveryWithNullptrFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "bb746406-bb83-4ddb-b943-d8f986369ab1");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_subscriberPortData[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_subscriberPortData[1]))
+        .WillOnce(Return(&m_subscriberPortData[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -1032,7 +1043,9 @@ void notifyServiceDiscovery(SubscriberPortData& portData)
 TIMING_TEST_F(iox_listener_test, NotifyingServiceDiscoveryEventWorks, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "538a50bc-60c8-4485-b70e-59d0c53f618b");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_subscriberPortData[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_subscriberPortData[1]))
+        .WillOnce(Return(&m_subscriberPortData[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -1052,7 +1065,9 @@ TIMING_TEST_F(iox_listener_test, NotifyingServiceDiscoveryEventWorks, Repeat(5),
 TIMING_TEST_F(iox_listener_test, NotifyingServiceDiscoveryEventWithContextDataWorks, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "257c27a5-95c6-489d-919f-125471b399e8");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_subscriberPortData[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_subscriberPortData[1]))
+        .WillOnce(Return(&m_subscriberPortData[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
     uint64_t someContextData = 0U;
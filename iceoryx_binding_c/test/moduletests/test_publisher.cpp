@@ -375,6 +375,91 @@ TEST_F(iox_pub_test, pubPublishChunckWithNullptr)
     IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_chunk(&m_sut, nullptr); }, iox::er::ENFORCE_VIOLATION);
 }
 
+TEST_F(iox_pub_test, loanChunksAllocatesTheRequestedNumberOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7efd3408-82e9-4bc8-9b56-02659a11b0bc");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS]{};
+    EXPECT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS, sizeof(DummySample)));
+    for (auto chunk : chunks)
+    {
+        EXPECT_NE(chunk, nullptr);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(iox_pub_test, loanChunksFailsWhenRequestingTooManyChunksInParallel)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "20fc7ab4-d0b7-46e8-a313-32687bd161ee");
+    constexpr uint64_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1U};
+    void* chunks[NUMBER_OF_CHUNKS]{};
+    EXPECT_EQ(AllocationResult_TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
+              iox_pub_loan_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS, sizeof(DummySample)));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(iox_pub_test, loanChunksReleasesAllChunksWhenOneAllocationFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a6971bea-8228-48b0-982c-295a3af312e6");
+    void* chunk = nullptr;
+    for (uint32_t i = 0U; i + 1U < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; ++i)
+    {
+        ASSERT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunk(&m_sut, &chunk, 100));
+    }
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{2U};
+    void* chunks[NUMBER_OF_CHUNKS]{};
+    EXPECT_EQ(AllocationResult_TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
+              iox_pub_loan_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS, 100));
+    EXPECT_EQ(chunks[0], nullptr);
+    EXPECT_EQ(chunks[1], nullptr);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks,
+                Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY - 1U));
+}
+
+TEST_F(iox_pub_test, publishChunksDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c85330f-fc72-47c4-900b-5c7ea93b277e");
+    iox_pub_offer(&m_sut);
+    this->Subscribe(&m_publisherPortData);
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS]{};
+    ASSERT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS, sizeof(DummySample)));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        static_cast<DummySample*>(chunks[i])->dummy = 4711 + i;
+    }
+    iox_pub_publish_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_chunkQueuePopper(&m_chunkQueueData);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = m_chunkQueuePopper.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_TRUE(*maybeSharedChunk == chunks[i]);
+        EXPECT_THAT(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy, Eq(4711 + i));
+    }
+    EXPECT_FALSE(m_chunkQueuePopper.tryPop().has_value());
+}
+
+TEST_F(iox_pub_test, pubLoanChunksWithNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fcdb712f-1b8a-4bc1-b1eb-36123e910c40");
+    void* chunks[1]{};
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_loan_chunks(nullptr, chunks, 1U, 100); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_loan_chunks(&m_sut, nullptr, 1U, 100); }, iox::er::ENFORCE_VIOLATION);
+}
+
+TEST_F(iox_pub_test, pubPublishChunksWithNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0716d26-4add-4ef8-8d6a-4b428f893aeb");
+    void* chunks[1]{};
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_chunks(nullptr, chunks, 1U); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_chunks(&m_sut, nullptr, 1U); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_chunks(&m_sut, chunks, 1U); }, iox::er::ENFORCE_VIOLATION);
+}
+
 TEST_F(iox_pub_test, pubOfferWithNullptr)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5588dacf-6e6c-44c6-835d-1dfeb03ff2c1");
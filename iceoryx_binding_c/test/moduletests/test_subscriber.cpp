@@ -316,6 +316,78 @@ TEST_F(iox_sub_test, releaseChunkQueuedChunksWorks)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(iox_sub_test, takeChunksWhenThereAreNoneReturnsNoChunkAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c62b84b-d2e3-4307-af2d-ee8d9af5e28e");
+    const void* chunks[2]{nullptr, nullptr};
+    uint64_t numberOfChunks{42U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfChunks), ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(numberOfChunks, Eq(0U));
+}
+
+TEST_F(iox_sub_test, takeChunksReceivesAllQueuedChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f8f9eb5-361f-4f31-84a8-999145dda2e0");
+    this->Subscribe(&m_portPtr);
+    struct data_t
+    {
+        int value;
+    };
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        static_cast<data_t*>(sharedChunk.getUserPayload())->value = static_cast<int>(i);
+        m_chunkPusher.push(sharedChunk);
+    }
+
+    const void* chunks[NUMBER_OF_CHUNKS + 1U]{nullptr, nullptr, nullptr, nullptr};
+    uint64_t numberOfChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, NUMBER_OF_CHUNKS + 1U, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    ASSERT_THAT(numberOfChunks, Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(static_cast<const data_t*>(chunks[i])->value, Eq(static_cast<int>(i)));
+        iox_sub_release_chunk(m_sut, chunks[i]);
+    }
+    EXPECT_THAT(chunks[NUMBER_OF_CHUNKS], Eq(nullptr));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(iox_sub_test, takeChunksIsLimitedByMaxNumberOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6fdaf23f-05d7-4cd3-bdbb-bd85b0a6bc56");
+    this->Subscribe(&m_portPtr);
+    m_chunkPusher.push(getChunkFromMemoryManager());
+    m_chunkPusher.push(getChunkFromMemoryManager());
+
+    const void* chunks[1]{nullptr};
+    uint64_t numberOfChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, 1U, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    EXPECT_THAT(numberOfChunks, Eq(1U));
+    EXPECT_TRUE(iox_sub_has_chunks(m_sut));
+}
+
+TEST_F(iox_sub_test, takeChunksWhenTooManyChunksAreHeldFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f40954be-fc24-4872-bd32-0702df0e1628");
+    this->Subscribe(&m_portPtr);
+    const void* chunk = nullptr;
+    for (uint64_t i = 0U; i < MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1U; ++i)
+    {
+        m_chunkPusher.push(getChunkFromMemoryManager());
+        iox_sub_take_chunk(m_sut, &chunk);
+    }
+
+    m_chunkPusher.push(getChunkFromMemoryManager());
+    const void* chunks[2]{nullptr, nullptr};
+    uint64_t numberOfChunks{0U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfChunks),
+              ChunkReceiveResult_TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    EXPECT_THAT(numberOfChunks, Eq(0U));
+}
+
 TEST_F(iox_sub_test, initialStateHasNewChunksFalse)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ced8e035-7748-4322-bf2f-517c5d1468d7");
@@ -471,6 +543,18 @@ TEST_F(iox_sub_test, subscriberTakeChunkWithNullptrFails)
     IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunk(nullptr, &chunk); }, iox::er::ENFORCE_VIOLATION);
 }
 
+TEST_F(iox_sub_test, subscriberTakeChunksWithNullptrFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d268788-3b07-4a28-b774-2da92097c1c0");
+    const void* chunks[1]{nullptr};
+    uint64_t numberOfChunks{0U};
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunks(nullptr, chunks, 1U, &numberOfChunks); },
+                             iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunks(m_sut, nullptr, 1U, &numberOfChunks); },
+                             iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunks(m_sut, chunks, 1U, nullptr); }, iox::er::ENFORCE_VIOLATION);
+}
+
 TEST_F(iox_sub_test, subReleaseChunkWithNullptrFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "425c9e6c-5211-4f35-b1d9-408e328757d0");
@@ -65,6 +65,42 @@ void IcePerfBase::latencyPerfTestFollower() noexcept
             break;
         }
 
+        // a burst is acknowledged only once all of its samples are received
+        for (auto i = 1U; i < perfTopic.subPackets; ++i)
+        {
+            receivePerfTopic();
+        }
+
         sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
     }
 }
+
+bool IcePerfBase::isBurstSupported() const noexcept
+{
+    return false;
+}
+
+void IcePerfBase::sendPerfTopicBurst(const uint32_t, const SendMode) noexcept
+{
+    std::cerr << "Bursts are not supported by this technology!" << std::endl;
+}
+
+iox::units::Duration IcePerfBase::burstPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                      const uint64_t numberOfBursts,
+                                                      const SendMode sendMode) noexcept
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (auto i = 0U; i < numberOfBursts; ++i)
+    {
+        sendPerfTopicBurst(payloadSizeInBytes, sendMode);
+        // wait for the acknowledgement of the follower
+        receivePerfTopic();
+    }
+
+    auto finish = std::chrono::steady_clock::now();
+
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
+    auto timePerSampleInNanoSeconds = (static_cast<uint64_t>(duration.count()) / (numberOfBursts * BURST_SIZE));
+    return iox::units::Duration::fromNanoseconds(timePerSampleInNanoSeconds);
+}
@@ -29,6 +29,8 @@ class IcePerfBase
 {
   public:
     static constexpr uint32_t ONE_KILOBYTE = 1024U;
+    /// @note must not exceed MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY of the iceoryx deployment
+    static constexpr uint32_t BURST_SIZE = 8U;
 
     virtual ~IcePerfBase() = default;
 
@@ -42,8 +44,18 @@ class IcePerfBase
     iox::units::Duration latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept;
     void latencyPerfTestFollower() noexcept;
 
+    /// @brief returns true if the technology is able to send bursts of BURST_SIZE samples
+    virtual bool isBurstSupported() const noexcept;
+    /// @brief sends numberOfBursts bursts of BURST_SIZE samples and waits after each burst for the acknowledgement
+    ///        of the follower
+    /// @return the average time it took to transfer a single sample of a burst
+    iox::units::Duration burstPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                             const uint64_t numberOfBursts,
+                                             const SendMode sendMode) noexcept;
+
   private:
     virtual void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept = 0;
+    virtual void sendPerfTopicBurst(const uint32_t payloadSizeInBytes, const SendMode sendMode) noexcept;
     virtual PerfTopic receivePerfTopic() noexcept = 0;
 };
 
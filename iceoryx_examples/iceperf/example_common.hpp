@@ -40,4 +40,10 @@ enum class RunFlag
     RUN
 };
 
+enum class SendMode
+{
+    SINGLE,
+    BATCH
+};
+
 #endif
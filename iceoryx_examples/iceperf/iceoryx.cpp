@@ -17,6 +17,7 @@
 
 #include "iceoryx.hpp"
 
+#include <array>
 #include <chrono>
 #include <thread>
 
@@ -28,7 +29,7 @@ Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName,
                  const iox::capro::IdString_t& subscriberName,
                  const iox::capro::IdString_t& eventName) noexcept
     : m_publisher({"IcePerf", publisherName, eventName}, iox::popo::PublisherOptions{1U})
-    , m_subscriber({"IcePerf", subscriberName, eventName}, iox::popo::SubscriberOptions{1U, 1U})
+    , m_subscriber({"IcePerf", subscriberName, eventName}, iox::popo::SubscriberOptions{BURST_SIZE, 1U})
 {
 }
 
@@ -85,6 +86,56 @@ void Iceoryx::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag run
     });
 }
 
+bool Iceoryx::isBurstSupported() const noexcept
+{
+    return true;
+}
+
+void Iceoryx::sendPerfTopicBurst(const uint32_t payloadSizeInBytes, const SendMode sendMode) noexcept
+{
+    std::array<void*, BURST_SIZE> userPayloads{};
+    if (sendMode == SendMode::SINGLE)
+    {
+        for (auto& userPayload : userPayloads)
+        {
+            m_publisher.loan(payloadSizeInBytes).and_then([&](auto& loanedUserPayload) {
+                userPayload = loanedUserPayload;
+            });
+        }
+    }
+    else if (m_publisher.loanBatch(iox::span<void*>(userPayloads.data(), userPayloads.size()), payloadSizeInBytes)
+                 .has_error())
+    {
+        return;
+    }
+
+    for (auto userPayload : userPayloads)
+    {
+        if (userPayload != nullptr)
+        {
+            auto sendSample = static_cast<PerfTopic*>(userPayload);
+            sendSample->payloadSize = payloadSizeInBytes;
+            sendSample->runFlag = RunFlag::RUN;
+            sendSample->subPackets = BURST_SIZE;
+        }
+    }
+
+    if (sendMode == SendMode::SINGLE)
+    {
+        for (auto userPayload : userPayloads)
+        {
+            if (userPayload != nullptr)
+            {
+                m_publisher.publish(userPayload);
+            }
+        }
+    }
+    else
+    {
+        m_publisher.publishBatch(iox::span<void* const>(userPayloads.data(), userPayloads.size()));
+    }
+}
+
 PerfTopic Iceoryx::receivePerfTopic() noexcept
 {
     bool hasReceivedSample{false};
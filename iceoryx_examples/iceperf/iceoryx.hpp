@@ -29,6 +29,7 @@ class Iceoryx : public IcePerfBase
     void initLeader() noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
+    bool isBurstSupported() const noexcept override;
 
   protected:
     Iceoryx(const iox::capro::IdString_t& publisherName,
@@ -37,6 +38,7 @@ class Iceoryx : public IcePerfBase
     virtual void init() noexcept;
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
+    void sendPerfTopicBurst(const uint32_t payloadSizeInBytes, const SendMode sendMode) noexcept override;
 
     iox::popo::UntypedPublisher m_publisher;
     iox::popo::UntypedSubscriber m_subscriber;
@@ -16,6 +16,7 @@
 
 #include "iceoryx_c.hpp"
 
+#include <array>
 #include <chrono>
 #include <thread>
 
@@ -28,7 +29,7 @@ IceoryxC::IceoryxC(const iox::capro::IdString_t& publisherName, const iox::capro
 
     iox_sub_options_t subscriberOptions;
     iox_sub_options_init(&subscriberOptions);
-    subscriberOptions.queueCapacity = 1U;
+    subscriberOptions.queueCapacity = BURST_SIZE;
     subscriberOptions.historyRequest = 1U;
     m_subscriber = iox_sub_init(&m_subscriberStorage, "IcePerf", subscriberName.c_str(), "C-API", &subscriberOptions);
 }
@@ -96,6 +97,57 @@ void IceoryxC::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag ru
     }
 }
 
+bool IceoryxC::isBurstSupported() const noexcept
+{
+    return true;
+}
+
+void IceoryxC::sendPerfTopicBurst(const uint32_t payloadSizeInBytes, const SendMode sendMode) noexcept
+{
+    std::array<void*, BURST_SIZE> userPayloads{};
+    if (sendMode == SendMode::SINGLE)
+    {
+        for (auto& userPayload : userPayloads)
+        {
+            if (iox_pub_loan_chunk(m_publisher, &userPayload, payloadSizeInBytes) != AllocationResult_SUCCESS)
+            {
+                userPayload = nullptr;
+            }
+        }
+    }
+    else if (iox_pub_loan_chunks(m_publisher, userPayloads.data(), userPayloads.size(), payloadSizeInBytes)
+             != AllocationResult_SUCCESS)
+    {
+        return;
+    }
+
+    for (auto userPayload : userPayloads)
+    {
+        if (userPayload != nullptr)
+        {
+            auto sendSample = static_cast<PerfTopic*>(userPayload);
+            sendSample->payloadSize = payloadSizeInBytes;
+            sendSample->runFlag = RunFlag::RUN;
+            sendSample->subPackets = BURST_SIZE;
+        }
+    }
+
+    if (sendMode == SendMode::SINGLE)
+    {
+        for (auto userPayload : userPayloads)
+        {
+            if (userPayload != nullptr)
+            {
+                iox_pub_publish_chunk(m_publisher, userPayload);
+            }
+        }
+    }
+    else
+    {
+        iox_pub_publish_chunks(m_publisher, userPayloads.data(), userPayloads.size());
+    }
+}
+
 PerfTopic IceoryxC::receivePerfTopic() noexcept
 {
     bool hasReceivedSample{false};
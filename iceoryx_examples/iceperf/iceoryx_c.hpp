@@ -32,11 +32,13 @@ class IceoryxC : public IcePerfBase
     void initLeader() noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
+    bool isBurstSupported() const noexcept override;
 
   private:
     void init() noexcept;
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
+    void sendPerfTopicBurst(const uint32_t payloadSizeInBytes, const SendMode sendMode) noexcept override;
 
     iox_pub_storage_t m_publisherStorage;
     iox_sub_storage_t m_subscriberStorage;
@@ -28,6 +28,7 @@
 #include "topic_data.hpp"
 #include "uds.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <vector>
@@ -113,6 +114,27 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
     }
     std::cout << std::endl;
 
+    // compare sending a burst of samples one by one with sending it as a batch; the payload sizes are limited to
+    // small samples since a burst occupies multiple chunks of a mempool simultaneously
+    std::vector<std::tuple<uint32_t, iox::units::Duration, iox::units::Duration>> burstMeasurements;
+    if (ipcTechnology.isBurstSupported())
+    {
+        const std::vector<uint32_t> burstPayloadSizes{16, 64, 256, 1 * IcePerfBase::ONE_KILOBYTE};
+        const uint64_t numberOfBursts{std::max(m_settings.numberOfSamples / IcePerfBase::BURST_SIZE, UINT64_C(1))};
+        std::cout << "Burst measurement for:";
+        separator = " ";
+        for (const auto payloadSize : burstPayloadSizes)
+        {
+            std::cout << separator << payloadSize << " [B]" << std::flush;
+            separator = ", ";
+
+            auto single = ipcTechnology.burstPerfTestLeader(payloadSize, numberOfBursts, SendMode::SINGLE);
+            auto batch = ipcTechnology.burstPerfTestLeader(payloadSize, numberOfBursts, SendMode::BATCH);
+            burstMeasurements.push_back(std::make_tuple(payloadSize, single, batch));
+        }
+        std::cout << std::endl;
+    }
+
     ipcTechnology.releaseFollower();
 
     ipcTechnology.shutdown();
@@ -137,6 +159,23 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
                   << std::endl;
     }
 
+    if (!burstMeasurements.empty())
+    {
+        std::cout << std::endl;
+        std::cout << "Bursts of " << IcePerfBase::BURST_SIZE << " samples, acknowledged by the follower." << std::endl;
+        std::cout << std::endl;
+        std::cout << "| Payload Size | Single Send per Sample [µs] | Batch Send per Sample [µs] |" << std::endl;
+        std::cout << "|-------------:|----------------------------:|---------------------------:|" << std::endl;
+        for (const auto& burstMeasurement : burstMeasurements)
+        {
+            auto singleInMicroseconds = static_cast<double>(std::get<1>(burstMeasurement).toNanoseconds()) / 1000.0;
+            auto batchInMicroseconds = static_cast<double>(std::get<2>(burstMeasurement).toNanoseconds()) / 1000.0;
+            std::cout << "| " << std::setw(7) << std::get<0>(burstMeasurement) << " [B]  | " << std::setw(27)
+                      << std::setprecision(2) << singleInMicroseconds << " | " << std::setw(26)
+                      << std::setprecision(2) << batchInMicroseconds << " |" << std::endl;
+        }
+    }
+
     std::cout << std::endl;
     std::cout << "Finished!" << std::endl;
 }
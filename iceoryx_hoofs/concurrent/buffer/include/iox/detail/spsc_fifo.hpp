@@ -18,8 +18,10 @@
 #ifndef IOX_HOOFS_CONCURRENT_BUFFER_SPSC_FIFO_HPP
 #define IOX_HOOFS_CONCURRENT_BUFFER_SPSC_FIFO_HPP
 
+#include "iox/algorithm.hpp"
 #include "iox/atomic.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 #include "iox/uninitialized_array.hpp"
 
 namespace iox
@@ -47,6 +49,14 @@ class SpscFifo
     ///         otherwise it contains a nullopt
     optional<ValueType> pop() noexcept;
 
+    /// @brief removes up to 'values.size()' of the oldest values from the fifo with a single update of the read
+    /// position
+    /// @note restricted thread-safe: can only be accessed from one thread. The authorization to pop from the FIFO can
+    /// be transferred to another thread if appropriate synchronization mechanisms are used.
+    /// @param[out] values storage for the removed values in the order of their insertion
+    /// @return the number of values which were removed and stored at the beginning of 'values'
+    uint64_t popBatch(const span<ValueType> values) noexcept;
+
     /// @brief returns true when the fifo is empty, otherwise false
     /// @note thread safe (the result might already be outdated when used). Expected to be called from either the push
     /// or the pop thread but not from a third thread
@@ -124,6 +124,26 @@ inline optional<ValueType> SpscFifo<ValueType, Capacity>::pop() noexcept
     m_readPos.store(currentReadPos + 1, std::memory_order_release);
     return out;
 }
+
+template <class ValueType, uint64_t Capacity>
+inline uint64_t SpscFifo<ValueType, Capacity>::popBatch(const span<ValueType> values) noexcept
+{
+    // see pop for the reasoning of the memory orders
+    auto currentReadPos = m_readPos.load(std::memory_order_relaxed);
+    const auto availableValues = m_writePos.load(std::memory_order_acquire) - currentReadPos;
+    const auto numberOfValues = algorithm::minVal(availableValues, values.size());
+
+    for (uint64_t i = 0U; i < numberOfValues; ++i)
+    {
+        values[i] = m_data[(currentReadPos + i) % Capacity];
+    }
+
+    if (numberOfValues > 0U)
+    {
+        m_readPos.store(currentReadPos + numberOfValues, std::memory_order_release);
+    }
+    return numberOfValues;
+}
 } // namespace concurrent
 } // namespace iox
 
@@ -19,7 +19,9 @@
 #define IOX_HOOFS_CONCURRENT_BUFFER_SPSC_SOFI_HPP
 
 #include "iceoryx_platform/platform_correction.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/atomic.hpp"
+#include "iox/span.hpp"
 #include "iox/type_traits.hpp"
 #include "iox/uninitialized_array.hpp"
 
@@ -131,6 +133,13 @@ class SpscSofi
     /// @return false if SpscSofi is empty, otherwise true
     bool pop(ValueType& valueOut) noexcept;
 
+    /// @brief pop up to 'valuesOut.size()' of the oldest elements with a single update of the read position
+    /// @param[out] valuesOut storage of the pop'ed values in the order of their insertion
+    /// @concurrent restricted thread safe: can only be called from one thread. The authorization to pop from the
+    /// SpscSofi can be transferred to another thread if appropriate synchronization mechanisms are used.
+    /// @return the number of pop'ed values which are stored at the beginning of 'valuesOut'
+    uint64_t popBatch(const span<ValueType> valuesOut) noexcept;
+
     /// @brief returns true if SpscSofi is empty, otherwise false
     /// @note the use of this function is limited in the concurrency case. if you
     ///         call this and in another thread pop is called the result can be out
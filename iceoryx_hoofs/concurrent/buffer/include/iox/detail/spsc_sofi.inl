@@ -154,6 +154,38 @@ inline bool SpscSofi<ValueType, CapacityValue>::pop(ValueType& valueOut) noexcep
     return popWasSuccessful;
 }
 
+template <class ValueType, uint64_t CapacityValue>
+inline uint64_t SpscSofi<ValueType, CapacityValue>::popBatch(const span<ValueType> valuesOut) noexcept
+{
+    uint64_t numberOfValues{0U};
+    // see pop for the reasoning of the memory orders
+    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_relaxed);
+
+    do
+    {
+        // SYNC POINT READ: m_data
+        // See explanation of the corresponding synchronization point in push()
+        const uint64_t availableValues = m_writePosition.load(std::memory_order_acquire) - currentReadPosition;
+        numberOfValues = algorithm::minVal(availableValues, valuesOut.size());
+
+        for (uint64_t i = 0U; i < numberOfValues; ++i)
+        {
+            // we use memcpy here, to ensure that there is no logic in copying the data
+            std::memcpy(&valuesOut[i], &m_data[(currentReadPosition + i) % m_size], sizeof(ValueType));
+        }
+
+        // If the producer overflowed in the meantime, m_readPosition was advanced and some of the copied values
+        // might be corrupted. The CAS detects this like in pop and the values are copied again. Since the producer
+        // always advances m_readPosition before it overrides the oldest value, a successful CAS guarantees that none
+        // of the copied values was overridden.
+    } while (!m_readPosition.compare_exchange_weak(currentReadPosition,
+                                                   currentReadPosition + numberOfValues,
+                                                   std::memory_order_acq_rel,
+                                                   std::memory_order_acquire));
+
+    return numberOfValues;
+}
+
 template <class ValueType, uint64_t CapacityValue>
 inline bool SpscSofi<ValueType, CapacityValue>::push(const ValueType& valueIn, ValueType& valueOut) noexcept
 {
@@ -0,0 +1,91 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_SYNC_FUTEX_SEMAPHORE_HPP
+#define IOX_HOOFS_CONCURRENT_SYNC_FUTEX_SEMAPHORE_HPP
+
+#include "iox/atomic.hpp"
+#include "iox/builder.hpp"
+#include "iox/optional.hpp"
+#include "iox/semaphore_interface.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+class FutexSemaphoreBuilder;
+
+/// @brief Semaphore which uses the semaphore value as futex word. It tracks the number of sleeping waiters
+///        in the shared memory so that 'post' only issues the wake up system call when somebody actually sleeps;
+///        when the waiting side is awake, posting is a single atomic increment.
+/// @note  On platforms without futex support the wait degrades to a busy loop.
+class FutexSemaphore : public detail::SemaphoreInterface<FutexSemaphore>
+{
+  public:
+    using Builder = FutexSemaphoreBuilder;
+
+    FutexSemaphore(const FutexSemaphore&) = delete;
+    FutexSemaphore(FutexSemaphore&&) = delete;
+    FutexSemaphore& operator=(const FutexSemaphore&) = delete;
+    FutexSemaphore& operator=(FutexSemaphore&&) = delete;
+
+    ~FutexSemaphore() noexcept = default;
+
+  private:
+    friend class optional<FutexSemaphore>;
+    friend class detail::SemaphoreInterface<FutexSemaphore>;
+
+    explicit FutexSemaphore(uint32_t initialValue) noexcept;
+
+    expected<void, SemaphoreError> post_impl() noexcept;
+
+    expected<void, SemaphoreError> wait_impl() noexcept;
+
+    expected<bool, SemaphoreError> try_wait_impl() noexcept;
+
+    expected<SemaphoreWaitState, SemaphoreError> timed_wait_impl(const units::Duration& timeout) noexcept;
+
+    /// @brief blocks until the semaphore value is not zero anymore, the timeout has passed or a spurious wake up
+    ///        occurred; a nullptr as timeout blocks without timeout
+    expected<void, SemaphoreError> sleep(const struct timespec* timeout) noexcept;
+
+    uint32_t* futexWord() noexcept;
+
+  private:
+    concurrent::Atomic<uint32_t> m_value{0U};
+    concurrent::Atomic<uint32_t> m_numberOfWaiters{0U};
+};
+
+class FutexSemaphoreBuilder
+{
+    /// @brief Set the initial value of the futex semaphore
+    IOX_BUILDER_PARAMETER(uint32_t, initialValue, 0U)
+
+    /// @brief Set if the futex semaphore can be stored in the shared memory
+    ///        for inter process usage; the futex semaphore is always inter process capable
+    IOX_BUILDER_PARAMETER(bool, isInterProcessCapable, true)
+
+  public:
+    /// @brief Create a futex semaphore
+    /// @param[in] uninitializedSemaphore since the semaphore is not movable the user has to provide
+    ///            memory to store the semaphore into - packed in an optional
+    /// @return an error describing the failure or success
+    expected<void, SemaphoreError> create(optional<FutexSemaphore>& uninitializedSemaphore) const noexcept;
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_SYNC_FUTEX_SEMAPHORE_HPP
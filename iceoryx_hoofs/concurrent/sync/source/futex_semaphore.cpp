@@ -0,0 +1,166 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/futex_semaphore.hpp"
+#include "iceoryx_platform/errno.hpp"
+#include "iceoryx_platform/futex.hpp"
+#include "iox/deadline_timer.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+expected<void, SemaphoreError>
+FutexSemaphoreBuilder::create(optional<FutexSemaphore>& uninitializedSemaphore) const noexcept
+{
+    if (m_initialValue > IOX_SEM_VALUE_MAX)
+    {
+        IOX_LOG(Error,
+                "The futex semaphore initial value of " << m_initialValue << " exceeds the maximum semaphore value "
+                                                        << IOX_SEM_VALUE_MAX);
+        return err(SemaphoreError::SEMAPHORE_OVERFLOW);
+    }
+
+    uninitializedSemaphore.emplace(m_initialValue);
+    return ok();
+}
+
+FutexSemaphore::FutexSemaphore(uint32_t initialValue) noexcept
+    : m_value(initialValue)
+{
+    static_assert(sizeof(m_value) == sizeof(uint32_t), "The futex word must be a plain 32 bit integer");
+}
+
+uint32_t* FutexSemaphore::futexWord() noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the kernel operates on the raw 32 bit value
+    return reinterpret_cast<uint32_t*>(&m_value);
+}
+
+expected<void, SemaphoreError> FutexSemaphore::post_impl() noexcept
+{
+    auto value = m_value.load(std::memory_order_relaxed);
+    do
+    {
+        if (value >= IOX_SEM_VALUE_MAX)
+        {
+            return err(SemaphoreError::SEMAPHORE_OVERFLOW);
+        }
+    } while (!m_value.compare_exchange_weak(value, value + 1U, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+    // fast path, nobody sleeps on the futex word therefore the system call can be skipped
+    if (m_numberOfWaiters.load(std::memory_order_seq_cst) == 0U)
+    {
+        return ok();
+    }
+
+    if (iox_futex_wake(futexWord(), 1) == -1)
+    {
+        IOX_LOG(Error, "Unable to wake up a waiter of the futex semaphore. This can indicate a corrupted system.");
+        return err(SemaphoreError::UNDEFINED);
+    }
+    return ok();
+}
+
+expected<bool, SemaphoreError> FutexSemaphore::try_wait_impl() noexcept
+{
+    auto value = m_value.load(std::memory_order_relaxed);
+    do
+    {
+        if (value == 0U)
+        {
+            return ok(false);
+        }
+    } while (!m_value.compare_exchange_weak(value, value - 1U, std::memory_order_acquire, std::memory_order_relaxed));
+
+    return ok(true);
+}
+
+expected<void, SemaphoreError> FutexSemaphore::wait_impl() noexcept
+{
+    while (true)
+    {
+        auto result = tryWait();
+        if (result.has_error())
+        {
+            return err(result.error());
+        }
+        if (result.value())
+        {
+            return ok();
+        }
+
+        auto sleepResult = sleep(nullptr);
+        if (sleepResult.has_error())
+        {
+            return sleepResult;
+        }
+    }
+}
+
+expected<SemaphoreWaitState, SemaphoreError> FutexSemaphore::timed_wait_impl(const units::Duration& timeout) noexcept
+{
+    iox::deadline_timer deadlineTimer(timeout);
+    while (true)
+    {
+        auto result = tryWait();
+        if (result.has_error())
+        {
+            return err(result.error());
+        }
+        if (result.value())
+        {
+            return ok(SemaphoreWaitState::NO_TIMEOUT);
+        }
+        if (deadlineTimer.hasExpired())
+        {
+            return ok(SemaphoreWaitState::TIMEOUT);
+        }
+
+        const auto remainingTime = deadlineTimer.remainingTime().timespec();
+        auto sleepResult = sleep(&remainingTime);
+        if (sleepResult.has_error())
+        {
+            return err(sleepResult.error());
+        }
+    }
+}
+
+expected<void, SemaphoreError> FutexSemaphore::sleep(const struct timespec* timeout) noexcept
+{
+    // announce the waiter before the semaphore value is checked again, this pairs with the post which first
+    // increments the value and afterwards checks for waiters; either the post sees the waiter and wakes it up or
+    // the waiter sees the incremented value and does not sleep at all
+    m_numberOfWaiters.fetch_add(1U, std::memory_order_seq_cst);
+    int32_t result{0};
+    int32_t errnum{0};
+    if (m_value.load(std::memory_order_seq_cst) == 0U)
+    {
+        result = iox_futex_wait(futexWord(), 0U, timeout);
+        errnum = errno;
+    }
+    m_numberOfWaiters.fetch_sub(1U, std::memory_order_relaxed);
+
+    if (result == -1 && errnum != EAGAIN && errnum != EINTR && errnum != ETIMEDOUT)
+    {
+        IOX_LOG(Error, "Unable to wait on the futex semaphore. This can indicate a corrupted system.");
+        return err(SemaphoreError::UNDEFINED);
+    }
+    return ok();
+}
+} // namespace concurrent
+} // namespace iox
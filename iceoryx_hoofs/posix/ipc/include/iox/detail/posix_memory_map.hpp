@@ -91,6 +91,10 @@ class PosixMemoryMapBuilder
     /// @brief Offset of the memory location
     IOX_BUILDER_PARAMETER(off_t, offset, 0)
 
+    /// @brief If set, the page tables of the mapping are populated during the mapping so that the first access of a
+    ///        page does not cause a page fault. Has no effect if the platform does not support it.
+    IOX_BUILDER_PARAMETER(bool, prefault, false)
+
   public:
     /// @brief creates a valid 'PosixMemoryMap' object. If the construction failed the
     ///        expected contains an enum value describing the error.
@@ -38,6 +38,7 @@ enum class PosixSharedMemoryObjectError : uint8_t
     MAPPING_SHARED_MEMORY_FAILED,
     UNABLE_TO_VERIFY_MEMORY_SIZE,
     REQUESTED_SIZE_EXCEEDS_ACTUAL_SIZE,
+    UNABLE_TO_LOCK_MEMORY,
     INTERNAL_LOGIC_FAILURE,
 };
 
@@ -117,7 +118,27 @@ class PosixSharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(access_rights, permissions, perms::none)
 
+    /// @brief If set, the page tables are populated when the shared memory is mapped which avoids the page
+    ///        faults on the first access of every page. It has no effect when the platform does not support it or
+    ///        when transparent huge pages are requested, since the pages must be advised before they are faulted in.
+    IOX_BUILDER_PARAMETER(bool, prefault, false)
+
+    /// @brief The number of threads which set a newly created shared memory to zero. Each thread zeroes a
+    ///        contiguous part of the memory, which shortens the creation of large shared memories. The value is
+    ///        limited to [1, MAX_NUMBER_OF_ZEROING_THREADS].
+    IOX_BUILDER_PARAMETER(uint32_t, numberOfZeroingThreads, 1U)
+
+    /// @brief If set, the system is advised to back the mapped memory with transparent huge pages, which reduces
+    ///        the TLB misses when the memory is accessed. If the advice is not supported, a warning is logged and
+    ///        regular pages are used.
+    IOX_BUILDER_PARAMETER(bool, transparentHugePages, false)
+
+    /// @brief If set, the mapped memory is locked into RAM so that it is never paged out
+    IOX_BUILDER_PARAMETER(bool, lockMemory, false)
+
   public:
+    static constexpr uint32_t MAX_NUMBER_OF_ZEROING_THREADS{64U};
+
     expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> create() noexcept;
 };
 } // namespace iox
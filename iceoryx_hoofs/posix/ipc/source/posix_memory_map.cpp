@@ -28,12 +28,15 @@ namespace detail
 {
 expected<PosixMemoryMap, PosixMemoryMapError> PosixMemoryMapBuilder::create() noexcept
 {
+    // NOLINTNEXTLINE(hicpp-signed-bitwise) flags are defined by POSIX as int
+    const int32_t flags = static_cast<int32_t>(m_flags) | (m_prefault ? IOX_MAP_POPULATE : 0);
+
     // AXIVION Next Construct AutosarC++19_03-A5.2.3, CertC++-EXP55 : Incompatibility with POSIX definition of mmap
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast) low-level memory management
     auto result = IOX_POSIX_CALL(mmap)(const_cast<void*>(m_baseAddressHint),
                                        static_cast<size_t>(m_length),
                                        convertToProtFlags(m_accessMode),
-                                       static_cast<int32_t>(m_flags),
+                                       flags,
                                        m_fileDescriptor,
                                        m_offset)
 
@@ -53,7 +56,7 @@ expected<PosixMemoryMap, PosixMemoryMapError> PosixMemoryMapBuilder::create() no
             "Unable to map memory with the following properties [ baseAddressHint = "
                 << iox::log::hex(m_baseAddressHint) << ", length = " << m_length
                 << ", fileDescriptor = " << m_fileDescriptor << ", access mode = " << asStringLiteral(m_accessMode)
-                << ", flags = " << std::bitset<FLAGS_BIT_SIZE>(static_cast<uint32_t>(m_flags)).to_string()
+                << ", flags = " << std::bitset<FLAGS_BIT_SIZE>(static_cast<uint32_t>(flags)).to_string()
                 << ", offset = " << iox::log::hex(m_offset) << " ]");
     return err(PosixMemoryMap::errnoToEnum(result.error().errnum));
 }
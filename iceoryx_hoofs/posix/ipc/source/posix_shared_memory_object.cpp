@@ -17,12 +17,18 @@
 
 #include "iox/posix_shared_memory_object.hpp"
 #include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/mman.hpp"
 #include "iceoryx_platform/unistd.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/attributes.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/filesystem.hpp"
 #include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
 #include "iox/signal_handler.hpp"
+#include "iox/thread.hpp"
 
+#include <array>
 #include <bitset>
 #include <cstdlib>
 #include <cstring>
@@ -50,8 +56,39 @@ static void memsetSigbusHandler(int) noexcept
     IOX_DISCARD_RESULT(result);
     _exit(EXIT_FAILURE);
 }
+
+static void zeroMemory(void* const memory, const uint64_t size, const uint32_t numberOfThreads) noexcept
+{
+    // every thread zeroes a contiguous range of whole pages so that no page is faulted in by two threads
+    const uint64_t pageSize = detail::pageSize();
+    const uint64_t numberOfPages = (size + pageSize - 1U) / pageSize;
+    const uint64_t partSize = ((numberOfPages + numberOfThreads - 1U) / numberOfThreads) * pageSize;
+
+    auto zeroPart = [memory, size, partSize](const uint64_t index) {
+        const uint64_t offset = index * partSize;
+        if (offset < size)
+        {
+            memset(static_cast<uint8_t*>(memory) + offset,
+                   0,
+                   static_cast<size_t>(algorithm::minVal(partSize, size - offset)));
+        }
+    };
+
+    std::array<optional<Thread>, PosixSharedMemoryObjectBuilder::MAX_NUMBER_OF_ZEROING_THREADS> threads;
+    for (uint32_t i = 1U; i < numberOfThreads; ++i)
+    {
+        if (ThreadBuilder().name("ShmZeroing").create(threads[i], [&zeroPart, i] { zeroPart(i); }).has_error())
+        {
+            IOX_LOG(Warn, "Unable to start a thread to zero the shared memory, continuing with the calling thread");
+            zeroPart(i);
+        }
+    }
+    zeroPart(0U);
+    // the threads are joined when 'threads' goes out of scope
+}
 } // namespace detail
 constexpr const void* const PosixSharedMemoryObject::NO_ADDRESS_HINT;
+constexpr uint32_t PosixSharedMemoryObjectBuilder::MAX_NUMBER_OF_ZEROING_THREADS;
 
 // NOLINTJUSTIFICATION the function size is related to the error handling and the cognitive complexity
 // results from the expanded log macro
@@ -121,6 +158,7 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                          .accessMode(m_accessMode)
                          .flags(detail::PosixMemoryMapFlags::SHARE_CHANGES)
                          .offset(0)
+                         .prefault(m_prefault && !m_transparentHugePages)
                          .create();
 
     if (!memoryMap)
@@ -130,6 +168,18 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
         return err(PosixSharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED);
     }
 
+    if (m_transparentHugePages)
+    {
+        IOX_POSIX_CALL(iox_madvise_hugepage)(memoryMap->getBaseAddress(), static_cast<size_t>(realSize))
+            .failureReturnValue(-1)
+            .evaluate()
+            .or_else([this](auto& r) {
+                IOX_LOG(Warn,
+                        "Transparent huge pages are not available for the shared memory ["
+                            << m_name << "], using regular pages. error: " << r.getHumanReadableErrnum());
+            });
+    }
+
     if (sharedMemory->hasOwnership())
     {
         IOX_LOG(Debug, "Trying to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << m_name << "]");
@@ -163,12 +213,31 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                 (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
                 m_permissions.value()));
 
-            memset(memoryMap->getBaseAddress(), 0, static_cast<size_t>(m_memorySizeInBytes));
+            detail::zeroMemory(memoryMap->getBaseAddress(),
+                               m_memorySizeInBytes,
+                               algorithm::maxVal(1U, algorithm::minVal(m_numberOfZeroingThreads,
+                                                                       MAX_NUMBER_OF_ZEROING_THREADS)));
         }
         IOX_LOG(Debug,
                 "Acquired " << m_memorySizeInBytes << " bytes successfully in the shared memory [" << m_name << "]");
     }
 
+    if (m_lockMemory)
+    {
+        auto lockResult = IOX_POSIX_CALL(iox_mlock)(memoryMap->getBaseAddress(), static_cast<size_t>(realSize))
+                              .failureReturnValue(-1)
+                              .evaluate();
+        if (lockResult.has_error())
+        {
+            printErrorDetails();
+            IOX_LOG(Error,
+                    "Unable to lock the shared memory into RAM, the memory lock limit (RLIMIT_MEMLOCK) might be too "
+                    "small. error: "
+                        << lockResult.error().getHumanReadableErrnum());
+            return err(PosixSharedMemoryObjectError::UNABLE_TO_LOCK_MEMORY);
+        }
+    }
+
     return ok(PosixSharedMemoryObject(std::move(*sharedMemory), std::move(*memoryMap)));
 }
 
@@ -236,6 +236,28 @@ constexpr bool isPowerOfTwo(const T n) noexcept
     // AXIVION Next Construct AutosarC++19_03-M0.1.2, AutosarC++19_03-M0.1.9, FaultDetection-DeadBranches : False positive! 'n' can be zero.
     return (n > 0) && ((n & (n - 1U)) == 0U);
 }
+
+/// @brief Counts the trailing zero bits of an unsigned 64 bit integer, i.e. the index of the least significant set bit
+/// @return the number of trailing zero bits or 64 if 'n' is zero
+/// @note uses a De Bruijn sequence lookup which is branch-free and portable across all supported compilers
+constexpr uint64_t countTrailingZeros(const uint64_t n) noexcept
+{
+    constexpr uint64_t NUMBER_OF_BITS{64U};
+    constexpr uint64_t DE_BRUIJN_SEQUENCE{0x03F79D71B4CB0A89U};
+    constexpr uint64_t DE_BRUIJN_SHIFT{58U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) lookup table in a constexpr function
+    constexpr uint8_t BIT_INDEX[NUMBER_OF_BITS]{0,  1,  48, 2,  57, 49, 28, 3,  61, 58, 50, 42, 38, 29, 17, 4,
+                                                62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+                                                63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+                                                46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6};
+    if (n == 0U)
+    {
+        return NUMBER_OF_BITS;
+    }
+    // 'n & (~n + 1)' isolates the least significant set bit
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) index is always in [0, 64[ due to the shift
+    return BIT_INDEX[((n & (~n + 1U)) * DE_BRUIJN_SEQUENCE) >> DE_BRUIJN_SHIFT];
+}
 } // namespace iox
 
 #include "iox/detail/algorithm.inl"
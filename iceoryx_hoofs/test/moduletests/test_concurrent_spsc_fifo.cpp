@@ -118,4 +118,73 @@ TEST_F(SpscFifo_Test, OverflowFromFullToEmptyRepetition)
         EXPECT_THAT(sut.empty(), Eq(true));
     }
 }
+TEST_F(SpscFifo_Test, PopBatchOnEmptyFifoReturnsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0be4bab-acaf-4fe2-a677-e1fda0fa46e1");
+    uint64_t values[FIFO_CAPACITY];
+    EXPECT_THAT(sut.popBatch(iox::span<uint64_t>(values)), Eq(0U));
+}
+
+TEST_F(SpscFifo_Test, PopBatchReturnsAllValuesInInsertionOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c81e8864-7441-4255-9e6c-9314fde9f496");
+    constexpr uint64_t NUMBER_OF_VALUES{FIFO_CAPACITY - 3U};
+    for (uint64_t k = 0; k < NUMBER_OF_VALUES; ++k)
+    {
+        EXPECT_THAT(sut.push(k), Eq(true));
+    }
+
+    uint64_t values[FIFO_CAPACITY];
+    ASSERT_THAT(sut.popBatch(iox::span<uint64_t>(values)), Eq(NUMBER_OF_VALUES));
+    for (uint64_t k = 0; k < NUMBER_OF_VALUES; ++k)
+    {
+        EXPECT_THAT(values[k], Eq(k));
+    }
+    EXPECT_THAT(sut.empty(), Eq(true));
+}
+
+TEST_F(SpscFifo_Test, PopBatchIsLimitedBySizeOfProvidedStorage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9dcbe418-0a88-483a-85ce-18a9b57e5941");
+    for (uint64_t k = 0; k < FIFO_CAPACITY; ++k)
+    {
+        EXPECT_THAT(sut.push(k), Eq(true));
+    }
+
+    constexpr uint64_t BATCH_SIZE{4U};
+    uint64_t values[BATCH_SIZE];
+    ASSERT_THAT(sut.popBatch(iox::span<uint64_t>(values)), Eq(BATCH_SIZE));
+    for (uint64_t k = 0; k < BATCH_SIZE; ++k)
+    {
+        EXPECT_THAT(values[k], Eq(k));
+    }
+
+    auto result = sut.pop();
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(result.value(), Eq(BATCH_SIZE));
+}
+
+TEST_F(SpscFifo_Test, PopBatchWorksWithWrapAround)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "85f2a2da-336e-41ed-8c22-0a641f87de29");
+    uint64_t m = 0;
+    uint64_t values[FIFO_CAPACITY];
+
+    for (uint64_t repetition = 0; repetition < 10; ++repetition)
+    {
+        const uint64_t numberOfValues = (repetition % FIFO_CAPACITY) + 1U;
+        for (uint64_t k = 0; k < numberOfValues; ++k)
+        {
+            EXPECT_THAT(sut.push(m + k), Eq(true));
+        }
+
+        ASSERT_THAT(sut.popBatch(iox::span<uint64_t>(values)), Eq(numberOfValues));
+        for (uint64_t k = 0; k < numberOfValues; ++k)
+        {
+            EXPECT_THAT(values[k], Eq(m + k));
+        }
+        m += numberOfValues;
+    }
+}
+
 } // namespace
@@ -438,4 +438,63 @@ TEST_F(SpscSofiTest, PopEmptyAfter)
     EXPECT_EQ(sofi.empty(), true);
 }
 
+TEST_F(SpscSofiTest, PopBatchOnEmptyReturnsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "590e7b37-2f00-4533-b347-33a7daa2ff9a");
+    int output[TEST_SOFI_CAPACITY];
+
+    EXPECT_EQ(sofi.popBatch(iox::span<int>(output)), 0U);
+}
+
+TEST_F(SpscSofiTest, PopBatchReturnsAllValuesInInsertionOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5881697b-c6bb-4b79-b060-95d8c2e2da10");
+    sofi.push(10, returnVal);
+    sofi.push(11, returnVal);
+    sofi.push(12, returnVal);
+
+    int output[TEST_SOFI_CAPACITY];
+    ASSERT_EQ(sofi.popBatch(iox::span<int>(output)), 3U);
+
+    EXPECT_EQ(output[0], 10);
+    EXPECT_EQ(output[1], 11);
+    EXPECT_EQ(output[2], 12);
+    EXPECT_EQ(sofi.empty(), true);
+}
+
+TEST_F(SpscSofiTest, PopBatchIsLimitedBySizeOfProvidedStorage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b830a292-a9f2-436d-8b6c-d4c796a4a6fe");
+    sofi.push(10, returnVal);
+    sofi.push(11, returnVal);
+    sofi.push(12, returnVal);
+
+    int output[2];
+    ASSERT_EQ(sofi.popBatch(iox::span<int>(output)), 2U);
+    EXPECT_EQ(output[0], 10);
+    EXPECT_EQ(output[1], 11);
+
+    EXPECT_EQ(sofi.pop(returnVal), true);
+    EXPECT_EQ(returnVal, 12);
+}
+
+TEST_F(SpscSofiTest, PopBatchAfterOverflowReturnsNewestValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52fb3345-74c9-453b-a1e3-4d82d5798af9");
+    constexpr int INITIAL_VALUE = 100;
+    constexpr int OFFSET = 2;
+    for (int i = 0; i < static_cast<int>(sofi.capacity()) + OFFSET; i++)
+    {
+        sofi.push(i + INITIAL_VALUE, returnVal);
+    }
+
+    int output[TEST_SOFI_CAPACITY];
+    ASSERT_EQ(sofi.popBatch(iox::span<int>(output)), sofi.capacity());
+    for (uint64_t i = 0; i < sofi.capacity(); ++i)
+    {
+        EXPECT_EQ(output[i], static_cast<int>(i) + INITIAL_VALUE + OFFSET);
+    }
+    EXPECT_EQ(sofi.empty(), true);
+}
+
 } // namespace
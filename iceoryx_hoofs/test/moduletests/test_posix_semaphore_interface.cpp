@@ -20,7 +20,9 @@
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_platform/platform_settings.hpp"
 #include "iceoryx_platform/time.hpp"
+#include "iox/atomic.hpp"
 #include "iox/duration.hpp"
+#include "iox/futex_semaphore.hpp"
 #include "iox/named_semaphore.hpp"
 #include "iox/semaphore_interface.hpp"
 #include "iox/spin_semaphore.hpp"
@@ -32,6 +34,7 @@
 #include <chrono>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace
 {
@@ -106,7 +109,16 @@ struct SpinSemaphoreTest
     }
 };
 
-using Implementations = Types<UnnamedSemaphoreTest, NamedSemaphoreTest, SpinSemaphoreTest>;
+struct FutexSemaphoreTest
+{
+    using SutType = iox::optional<concurrent::FutexSemaphore>;
+    static iox::expected<void, SemaphoreError> create(SutType& sut, const uint32_t initialValue)
+    {
+        return concurrent::FutexSemaphoreBuilder().initialValue(initialValue).isInterProcessCapable(false).create(sut);
+    }
+};
+
+using Implementations = Types<UnnamedSemaphoreTest, NamedSemaphoreTest, SpinSemaphoreTest, FutexSemaphoreTest>;
 
 TYPED_TEST_SUITE(SemaphoreInterfaceTest, Implementations, );
 
@@ -315,4 +327,34 @@ TYPED_TEST(SemaphoreInterfaceTest, TimedWaitBlocksAtLeastDefinedSleepTimeAndSign
 
     EXPECT_THAT(std::chrono::nanoseconds(end - start).count(), Ge(this->TIMING_TEST_WAIT_TIME.toNanoseconds()));
 }
+
+TYPED_TEST(SemaphoreInterfaceTest, EveryPostWakesUpOneBlockedWaiter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "adef03bc-94bc-46da-b8c4-c1399e7b67e6");
+
+    constexpr uint64_t NUMBER_OF_WAITERS{3U};
+    iox::concurrent::Atomic<uint64_t> numberOfWokenUpWaiters{0U};
+    std::vector<std::thread> waiters;
+    for (uint64_t i = 0U; i < NUMBER_OF_WAITERS; ++i)
+    {
+        waiters.emplace_back([&] {
+            ASSERT_FALSE(this->sut->wait().has_error());
+            ++numberOfWokenUpWaiters;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::nanoseconds(this->TIMING_TEST_WAIT_TIME.toNanoseconds()));
+    EXPECT_THAT(numberOfWokenUpWaiters.load(), Eq(0U));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_WAITERS; ++i)
+    {
+        ASSERT_FALSE(this->sut->post().has_error());
+    }
+
+    for (auto& waiter : waiters)
+    {
+        waiter.join();
+    }
+    EXPECT_THAT(numberOfWokenUpWaiters.load(), Eq(NUMBER_OF_WAITERS));
+}
 } // namespace
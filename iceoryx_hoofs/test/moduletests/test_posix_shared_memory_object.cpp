@@ -236,5 +236,75 @@ TEST_F(SharedMemoryObject_Test, SettingPermissionsWorks)
 }
 #endif
 
+TEST_F(SharedMemoryObject_Test, CreateWithPrefaultAndMultipleZeroingThreadsProvidesZeroedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "10431039-c912-43d4-b444-6ede51611935");
+    // a size which is not a multiple of the page size to cover a partial last part
+    const uint64_t MEMORY_SIZE = (1U << 20U) + 123U;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmZeroing")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .permissions(perms::owner_all)
+                   .prefault(true)
+                   .numberOfZeroingThreads(3U)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint8_t*>(sut.getBaseAddress());
+    uint64_t numberOfNonZeroBytes{0U};
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        numberOfNonZeroBytes += (data_ptr[i] != 0U) ? 1U : 0U;
+    }
+    EXPECT_THAT(numberOfNonZeroBytes, Eq(0U));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithTooManyZeroingThreadsIsLimitedAndSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e1ac560-902c-4ddf-a7da-6cf5ff80f433");
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmZeroing")
+                   .memorySizeInBytes(4096U)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .numberOfZeroingThreads(PosixSharedMemoryObjectBuilder::MAX_NUMBER_OF_ZEROING_THREADS + 1U)
+                   .create();
 
+    EXPECT_THAT(sut.has_error(), Eq(false));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithTransparentHugePagesSucceedsAlsoWhenTheSystemDoesNotSupportThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "693345cd-7719-4d1a-83ed-54f48924fe67");
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmHugePages")
+                   .memorySizeInBytes(4U << 20U)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .transparentHugePages(true)
+                   .prefault(true)
+                   .create();
+
+    EXPECT_THAT(sut.has_error(), Eq(false));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithLockedMemorySucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d40f3ca-2ce6-4b22-a065-19d7c463fd02");
+#ifdef _WIN32
+    GTEST_SKIP() << "Locking memory is not supported on this platform";
+#endif
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmLocked")
+                   .memorySizeInBytes(4096U)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .lockMemory(true)
+                   .create();
+
+    EXPECT_THAT(sut.has_error(), Eq(false));
+}
 } // namespace
@@ -226,4 +226,34 @@ TYPED_TEST(algorithm_test_isPowerOfTwo, MaxValueForTypeIsNotPowerOfTwo)
     ::testing::Test::RecordProperty("TEST_ID", "2abdb27d-58de-4e3d-b8fb-8e5f1f3e6327");
     EXPECT_FALSE(isPowerOfTwo(static_cast<typename TestFixture::CurrentType>(TestFixture::MAX)));
 }
+
+TEST(algorithm_test_countTrailingZeros, ZeroHasSixtyFourTrailingZeros)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0032c6ca-149f-496c-8dfd-8f892c82bb90");
+    EXPECT_THAT(countTrailingZeros(0U), Eq(64U));
+}
+
+TEST(algorithm_test_countTrailingZeros, SingleBitValuesReturnTheBitIndex)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6718247c-fd0c-4be3-bc2a-2c3e9b43e035");
+    for (uint64_t i = 0U; i < 64U; ++i)
+    {
+        EXPECT_THAT(countTrailingZeros(static_cast<uint64_t>(1U) << i), Eq(i));
+    }
+}
+
+TEST(algorithm_test_countTrailingZeros, HigherBitsAreIgnored)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d96831ca-7eb2-4103-bbe5-f15d304b4468");
+    EXPECT_THAT(countTrailingZeros(std::numeric_limits<uint64_t>::max()), Eq(0U));
+    EXPECT_THAT(countTrailingZeros(0xF0F0'0000'0000'0100U), Eq(8U));
+    EXPECT_THAT(countTrailingZeros(0x8000'0000'0000'0000U), Eq(63U));
+}
+
+TEST(algorithm_test_countTrailingZeros, IsUsableAtCompileTime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a905139-13f5-4014-8474-272fdf91130c");
+    constexpr uint64_t TRAILING_ZEROS = countTrailingZeros(0x20U);
+    EXPECT_THAT(TRAILING_ZEROS, Eq(5U));
+}
 } // namespace
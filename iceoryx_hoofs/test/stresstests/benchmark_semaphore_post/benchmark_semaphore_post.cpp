@@ -0,0 +1,62 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/futex.hpp"
+#include "iox/futex_semaphore.hpp"
+#include "iox/unnamed_semaphore.hpp"
+
+#include "../benchmark_optional_and_expected/benchmark.hpp"
+
+iox::optional<iox::UnnamedSemaphore> unnamedSemaphore;
+iox::optional<iox::concurrent::FutexSemaphore> futexSemaphore;
+uint32_t futexWord{0U};
+
+// every benchmark decrements the semaphore again to keep its value away from the overflow
+
+void unnamedSemaphorePost()
+{
+    IOX_DISCARD_RESULT(unnamedSemaphore->post());
+    IOX_DISCARD_RESULT(unnamedSemaphore->tryWait());
+}
+
+void futexSemaphorePostWithoutWaiter()
+{
+    IOX_DISCARD_RESULT(futexSemaphore->post());
+    IOX_DISCARD_RESULT(futexSemaphore->tryWait());
+}
+
+// this is what every post of the futex semaphore would cost without the waiter flag
+void futexSemaphorePostWithWakeSyscall()
+{
+    IOX_DISCARD_RESULT(futexSemaphore->post());
+    IOX_DISCARD_RESULT(iox_futex_wake(&futexWord, 1));
+    IOX_DISCARD_RESULT(futexSemaphore->tryWait());
+}
+
+int main()
+{
+    iox::UnnamedSemaphoreBuilder().initialValue(0U).isInterProcessCapable(true).create(unnamedSemaphore).expect(
+        "Unable to create unnamed semaphore");
+    iox::concurrent::FutexSemaphoreBuilder().initialValue(0U).create(futexSemaphore).expect(
+        "Unable to create futex semaphore");
+
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    BENCHMARK(unnamedSemaphorePost, timeout);
+    BENCHMARK(futexSemaphorePostWithoutWaiter, timeout);
+    BENCHMARK(futexSemaphorePostWithWakeSyscall, timeout);
+}
@@ -0,0 +1,189 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "iox/posix_shared_memory_object.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+
+constexpr uint64_t MEGABYTE{1U << 20U};
+constexpr uint64_t DEFAULT_SEGMENT_SIZE_IN_MEGABYTE{1024U};
+constexpr uint64_t NUMBER_OF_RANDOM_ACCESSES{20000000U};
+
+struct SegmentOptions
+{
+    const char* name;
+    bool prefault;
+    uint32_t zeroingThreads;
+    bool transparentHugePages;
+    bool lockMemory;
+};
+
+/// @brief Counts the data TLB misses of the calling thread, if the platform provides the hardware counter
+class DataTlbMissCounter
+{
+  public:
+    DataTlbMissCounter()
+    {
+#if defined(__linux__)
+        perf_event_attr attributes{};
+        attributes.type = PERF_TYPE_HW_CACHE;
+        attributes.size = sizeof(perf_event_attr);
+        attributes.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8U)
+                            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+        attributes.disabled = 1U;
+        attributes.exclude_kernel = 1U;
+        attributes.exclude_hv = 1U;
+        m_fileDescriptor = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+    }
+
+    DataTlbMissCounter(const DataTlbMissCounter&) = delete;
+    DataTlbMissCounter& operator=(const DataTlbMissCounter&) = delete;
+
+    ~DataTlbMissCounter()
+    {
+#if defined(__linux__)
+        if (m_fileDescriptor >= 0)
+        {
+            close(m_fileDescriptor);
+        }
+#endif
+    }
+
+    bool isAvailable() const
+    {
+        return m_fileDescriptor >= 0;
+    }
+
+    void start()
+    {
+#if defined(__linux__)
+        if (isAvailable())
+        {
+            ioctl(m_fileDescriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_fileDescriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    uint64_t stop()
+    {
+        uint64_t count{0U};
+#if defined(__linux__)
+        if (isAvailable())
+        {
+            ioctl(m_fileDescriptor, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(m_fileDescriptor, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count)))
+            {
+                count = 0U;
+            }
+        }
+#endif
+        return count;
+    }
+
+  private:
+    int m_fileDescriptor{-1};
+};
+
+void measure(const SegmentOptions& options, const uint64_t segmentSize)
+{
+    auto startTime = std::chrono::steady_clock::now();
+    auto sharedMemory = iox::PosixSharedMemoryObjectBuilder()
+                            .name("iox_bm_shared_memory_creation")
+                            .memorySizeInBytes(segmentSize)
+                            .accessMode(iox::AccessMode::ReadWrite)
+                            .openMode(iox::OpenMode::PurgeAndCreate)
+                            .permissions(iox::perms::owner_all)
+                            .prefault(options.prefault)
+                            .numberOfZeroingThreads(options.zeroingThreads)
+                            .transparentHugePages(options.transparentHugePages)
+                            .lockMemory(options.lockMemory)
+                            .create();
+    auto creationTime = std::chrono::steady_clock::now() - startTime;
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::left << std::setw(32) << options.name << std::right;
+    if (sharedMemory.has_error())
+    {
+        std::cout << " : creation failed" << std::endl;
+        return;
+    }
+
+    // random reads spread over the whole segment, like chunks of many mempools which are accessed by the applications
+    const auto* memory = static_cast<const volatile uint64_t*>(sharedMemory->getBaseAddress());
+    const uint64_t numberOfWords = segmentSize / sizeof(uint64_t);
+    std::mt19937_64 randomGenerator{42U};
+    DataTlbMissCounter tlbMissCounter;
+    uint64_t sum{0U};
+    startTime = std::chrono::steady_clock::now();
+    tlbMissCounter.start();
+    for (uint64_t i = 0U; i < NUMBER_OF_RANDOM_ACCESSES; ++i)
+    {
+        sum += memory[randomGenerator() % numberOfWords];
+    }
+    const auto tlbMisses = tlbMissCounter.stop();
+    auto accessTime = std::chrono::steady_clock::now() - startTime;
+
+    std::cout << " : creation " << std::setw(6)
+              << std::chrono::duration_cast<std::chrono::milliseconds>(creationTime).count() << " ms, random access "
+              << std::setw(4)
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(accessTime).count() / NUMBER_OF_RANDOM_ACCESSES
+              << " ns";
+    if (tlbMissCounter.isAvailable())
+    {
+        std::cout << ", dTLB misses " << std::setw(9) << tlbMisses;
+    }
+    else
+    {
+        std::cout << ", dTLB misses n/a";
+    }
+    std::cout << (sum == 0U ? "" : " (memory was not zeroed)") << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    const uint64_t segmentSize =
+        ((argc > 1) ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_SEGMENT_SIZE_IN_MEGABYTE) * MEGABYTE;
+    const uint32_t numberOfThreads = std::max(1U, std::thread::hardware_concurrency());
+
+    std::cout << "segment size " << segmentSize / MEGABYTE << " MB, " << numberOfThreads << " zeroing threads"
+              << std::endl;
+    for (const auto& options : {SegmentOptions{"default", false, 1U, false, false},
+                                SegmentOptions{"prefault", true, 1U, false, false},
+                                SegmentOptions{"parallel zeroing", false, numberOfThreads, false, false},
+                                SegmentOptions{"prefault + parallel zeroing", true, numberOfThreads, false, false},
+                                SegmentOptions{"transparent huge pages", false, numberOfThreads, true, false},
+                                SegmentOptions{"prefault + lock memory", true, numberOfThreads, false, true}})
+    {
+        measure(options, segmentSize);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -38,6 +38,7 @@ option(TEST_WITH_HUGE_PAYLOAD "Build Tests which use payload bigger than 2GB" OF
 option(TOML_CONFIG "TOML support for RouDi with dynamic configuration" ON)
 option(IOX_EXPERIMENTAL_32_64_BIT_MIX_MODE "Enable experimental 32<->64 bit mix mode zero-copy communication" OFF)
 option(IOX_EXPERIMENTAL_POSH "Export experimental posh features (no guarantees)" OFF)
+option(IOX_FUTEX_SEMAPHORE "Use a futex based semaphore for the listener notification (Linux only)" OFF)
 option(IOX_REPRODUCIBLE_BUILD "Create reproducible builds by omit setting the build timestamp in the version header" ON)
 
 set(CMAKE_EXPORT_COMPILE_COMMANDS ON) # "Create compile_commands.json file"
@@ -98,5 +99,6 @@ function(show_config_options)
   message("          TOML_CONFIG..........................: " ${TOML_CONFIG})
   message("          IOX_EXPERIMENTAL_32_64_BIT_MIX_MODE..: " ${IOX_EXPERIMENTAL_32_64_BIT_MIX_MODE})
   message("          IOX_EXPERIMENTAL_POSH................: " ${IOX_EXPERIMENTAL_POSH})
+  message("          IOX_FUTEX_SEMAPHORE..................: " ${IOX_FUTEX_SEMAPHORE})
   message("          IOX_REPRODUCIBLE_BUILD...............: " ${IOX_REPRODUCIBLE_BUILD})
 endfunction()
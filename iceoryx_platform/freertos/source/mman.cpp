@@ -86,3 +86,15 @@ int munmap(void*, size_t)
 {
     return 0;
 }
+
+int iox_madvise_hugepage(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mlock(const void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
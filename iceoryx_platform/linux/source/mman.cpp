@@ -34,3 +34,13 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_madvise_hugepage(void* addr, size_t length)
+{
+    return madvise(addr, length, MADV_HUGEPAGE);
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
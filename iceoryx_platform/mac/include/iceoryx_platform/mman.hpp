@@ -23,4 +23,15 @@ int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
 int iox_shm_close(int fd);
 
+/// @brief mmap flag which populates the page tables of the mapping, 0 if it is not supported
+#define IOX_MAP_POPULATE 0
+
+/// @brief advises the system to back the memory range with transparent huge pages
+/// @return 0 on success, -1 and errno is set otherwise
+int iox_madvise_hugepage(void* addr, size_t length);
+
+/// @brief locks the memory range into RAM
+/// @return 0 on success, -1 and errno is set otherwise
+int iox_mlock(const void* addr, size_t length);
+
 #endif // IOX_HOOFS_MAC_PLATFORM_MMAN_HPP
@@ -43,3 +43,14 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_madvise_hugepage(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
@@ -51,4 +51,15 @@ int iox_shm_close(int fd);
 void internal_iox_shm_set_size(int fd, off_t length);
 
 off_t internal_iox_shm_get_size(int fd);
+
+/// @brief mmap flag which populates the page tables of the mapping, 0 if it is not supported
+#define IOX_MAP_POPULATE 0
+
+/// @brief advises the system to back the memory range with transparent huge pages
+/// @return 0 on success, -1 and errno is set otherwise
+int iox_madvise_hugepage(void* addr, size_t length);
+
+/// @brief locks the memory range into RAM
+/// @return 0 on success, -1 and errno is set otherwise
+int iox_mlock(const void* addr, size_t length);
 #endif // IOX_HOOFS_WIN_PLATFORM_MMAN_HPP
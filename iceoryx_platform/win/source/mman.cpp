@@ -266,3 +266,15 @@ off_t internal_iox_shm_get_size(int fd)
     fclose(shm_state);
     return shm_size;
 }
+
+int iox_madvise_hugepage(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mlock(const void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
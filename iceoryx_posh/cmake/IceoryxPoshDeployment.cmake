@@ -135,6 +135,10 @@ configure_option(
     NAME IOX_MAX_NUMBER_OF_NOTIFIERS
     DEFAULT_VALUE 256
 )
+configure_option(
+    NAME IOX_CONDITION_LISTENER_SPIN_ITERATIONS
+    DEFAULT_VALUE 0
+)
 configure_option(
     NAME IOX_MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY
     DEFAULT_VALUE 4
@@ -159,6 +163,13 @@ else()
     set(IOX_INTERPROCESS_SEMAPHORE UnnamedSemaphore)
 endif()
 
+if(IOX_FUTEX_SEMAPHORE)
+    if(NOT LINUX)
+        message(WARNING "IOX_FUTEX_SEMAPHORE is only supported on Linux, listeners will busy wait")
+    endif()
+    set(IOX_INTERPROCESS_SEMAPHORE concurrent::FutexSemaphore)
+endif()
+
 message(STATUS "[i] IOX_EXPERIMENTAL_POSH_FLAG: ${IOX_EXPERIMENTAL_POSH_FLAG}")
 message(STATUS "[i] IOX_INTERPROCESS_LOCK: ${IOX_INTERPROCESS_LOCK}")
 message(STATUS "[i] IOX_INTERPROCESS_SEMAPHORE: ${IOX_INTERPROCESS_SEMAPHORE}")
@@ -75,7 +75,8 @@ constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBE
 // 1x publisherPort process introspection
 // 3x publisherPort port introspection
 constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
+// The service registry is using one publisherPort for the snapshots and one for the deltas
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 2;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
@@ -111,6 +112,11 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+/// @note a listener polls its semaphore this often before it goes to sleep; while it spins, notifiers using a
+/// backend with a waiter flag like the 'FutexSemaphore' do not need a system call to wake it up
+constexpr uint32_t CONDITION_LISTENER_SPIN_ITERATIONS = build::IOX_CONDITION_LISTENER_SPIN_ITERATIONS;
+// Latency histograms with logarithmic buckets; the last bucket covers everything from ~4s upwards
+constexpr uint32_t NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS = 24U;
 //--------- Communication Resources End---------------------
 
 // Memory
@@ -120,6 +126,14 @@ constexpr uint32_t MAX_SHM_SEGMENTS = build::IOX_MAX_SHM_SEGMENTS;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
 
+// Per-thread chunk caches; a mempool with a chunk cache depth > 0 provides this number of caches for all threads of
+// all processes, the threads which do not get a cache directly use the free list of the mempool
+constexpr uint32_t MAX_NUMBER_OF_CHUNK_CACHES_PER_MEMPOOL = 32U;
+constexpr uint32_t MAX_CHUNK_CACHE_DEPTH = 256U;
+// Mempool statistics; bucket i of the chunk fill histogram counts the allocations which use between i/N and (i+1)/N
+// of the chunk size
+constexpr uint32_t NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS = 8U;
+
 constexpr uint32_t CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT{8U};
 constexpr uint32_t CHUNK_NO_USER_HEADER_SIZE{0U};
 constexpr uint32_t CHUNK_NO_USER_HEADER_ALIGNMENT{1U};
@@ -141,6 +155,14 @@ constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
 constexpr const char SERVICE_DISCOVERY_SERVICE_NAME[] = "ServiceDiscovery";
 constexpr const char SERVICE_DISCOVERY_INSTANCE_NAME[] = "RouDi_ID";
 constexpr const char SERVICE_DISCOVERY_EVENT_NAME[] = "ServiceRegistry";
+constexpr const char SERVICE_DISCOVERY_DELTA_EVENT_NAME[] = "ServiceRegistryDelta";
+/// @brief maximum number of changed entries which are transferred with one delta of the service registry
+constexpr uint32_t SERVICE_REGISTRY_DELTA_CAPACITY = 64U;
+/// @brief number of deltas which are kept in the history and the queue of the service discovery; RouDi publishes a
+/// full snapshot of the service registry at least after this number of deltas so that a late joiner or a service
+/// discovery which missed some deltas can always catch up with the latest snapshot and the subsequent deltas
+constexpr uint32_t SERVICE_REGISTRY_DELTA_HISTORY =
+    (MAX_PUBLISHER_HISTORY < 8U) ? static_cast<uint32_t>(MAX_PUBLISHER_HISTORY) : 8U;
 
 // Resource prefix
 constexpr uint32_t RESOURCE_PREFIX_LENGTH = 13; // 'iox1_' + MAX_UINT16_SIZE + '_i_'/'_u_'
@@ -289,7 +311,11 @@ using namespace units::duration_literals;
 constexpr units::Duration PROCESS_DEFAULT_TERMINATION_DELAY = 0_s;
 constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
+/// @brief interval of the process monitoring in the discovery loop; the ports wake up the discovery loop when they
+/// have to be processed, therefore this is not the latency of the discovery
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
+/// @brief maximum number of threads which concurrently process the requests of the runtimes
+constexpr uint32_t MAX_RUNTIME_MESSAGES_THREADS = 16U;
 
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
@@ -0,0 +1,98 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_CHUNK_CACHE_HPP
+#define IOX_POSH_MEPOO_CHUNK_CACHE_HPP
+
+#include "iox/atomic.hpp"
+#include "iox/not_null.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Magazine of free chunk indices of a MemPool which is exclusively used by one thread of one process. It is
+///        placed in the management memory of the MemPool in order to be able to reclaim the cached chunks when the
+///        owning process terminated without returning them to the MemPool.
+/// @note push and pop must only be called by the owner of the cache
+class ChunkCache
+{
+  public:
+    using Owner_t = uint64_t;
+    static constexpr Owner_t NO_OWNER{0U};
+
+    ChunkCache() noexcept = default;
+    ~ChunkCache() noexcept = default;
+
+    ChunkCache(const ChunkCache&) = delete;
+    ChunkCache(ChunkCache&&) = delete;
+    ChunkCache& operator=(const ChunkCache&) = delete;
+    ChunkCache& operator=(ChunkCache&&) = delete;
+
+    /// @brief Sets the memory for the cached indices
+    /// @param[in] indices is the memory for the indices, it must be able to hold capacity elements
+    /// @param[in] capacity is the maximum number of indices the cache can hold
+    void init(not_null<uint32_t*> indices, const uint32_t capacity) noexcept;
+
+    /// @brief Creates the owner of a cache from the pid of a process and a process wide unique id of a thread
+    /// @param[in] pid of the process
+    /// @param[in] threadId of the thread, must not be 0
+    /// @return the owner
+    static Owner_t createOwner(const uint32_t pid, const uint32_t threadId) noexcept;
+
+    /// @brief Extracts the pid of the process from an owner
+    /// @param[in] owner from which the pid shall be extracted
+    /// @return the pid of the process
+    static uint32_t pidOf(const Owner_t owner) noexcept;
+
+    /// @brief Tries to become the owner of the cache
+    /// @param[in] owner which wants to use the cache
+    /// @return true if the cache was unused and is now owned by owner, otherwise false
+    bool tryClaim(const Owner_t owner) noexcept;
+
+    /// @brief Gives up the ownership of the cache, the cache must be empty
+    void release() noexcept;
+
+    /// @brief Returns the current owner of the cache or NO_OWNER
+    Owner_t getOwner() const noexcept;
+
+    /// @brief Adds an index to the cache
+    /// @param[in] index to add
+    /// @return false if the cache is full, otherwise true
+    bool push(const uint32_t index) noexcept;
+
+    /// @brief Removes the most recently added index from the cache
+    /// @param[out] index which was removed
+    /// @return false if the cache is empty, otherwise true
+    bool pop(uint32_t& index) noexcept;
+
+    uint32_t size() const noexcept;
+    uint32_t capacity() const noexcept;
+
+  private:
+    concurrent::Atomic<Owner_t> m_owner{NO_OWNER};
+    /// the size is atomic since RouDi reads it when it reclaims the chunks of a terminated process
+    concurrent::Atomic<uint32_t> m_size{0U};
+    uint32_t m_capacity{0U};
+    RelativePointer<uint32_t> m_indices;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_CACHE_HPP
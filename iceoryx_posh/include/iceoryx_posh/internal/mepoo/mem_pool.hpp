@@ -18,6 +18,8 @@
 #ifndef IOX_POSH_MEPOO_MEM_POOL_HPP
 #define IOX_POSH_MEPOO_MEM_POOL_HPP
 
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/atomic.hpp"
@@ -43,18 +45,53 @@ struct MemPoolInfo
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
+    /// @brief the maximum number of used chunks since the last call of MemPool::collectInfo
+    uint32_t m_maxUsedChunksInInterval{0};
+    /// @brief the number of getChunk calls which failed since the MemPool has no free chunk left
+    uint64_t m_allocationFailures{0};
+    /// @brief bucket i counts the allocations which requested between i/N and (i+1)/N of the chunk size
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) plain data like the other members
+    uint64_t m_chunkFillHistogram[NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS]{};
 };
 
+/// @brief Pool of equally sized chunks with a lock-free free list.
+///
+/// About the chunk cache:
+///     With a chunk cache depth > 0 every thread which uses the MemPool gets a cache for up to depth free chunks in
+///     front of the free list, as long as one of the MAX_NUMBER_OF_CHUNK_CACHES_PER_MEMPOOL caches is unused. The
+///     cache is refilled from and flushed to the free list with half of its depth at once, which reduces the
+///     contention on the free list when many threads loan and release chunks of the same MemPool. The cached chunks
+///     are counted as free chunks, therefore getUsedChunks and getMinFree are not affected by the cache. But the
+///     cached chunks are only available for their thread, i.e. another thread might run out of chunks while there
+///     are still free chunks in the caches. The caches are flushed when a thread terminates and RouDi reclaims the
+///     caches of a process which terminated abnormally with reclaimChunkCaches.
+///
+/// About the statistics:
+///     The number of used chunks, the minimum number of free chunks, the maximum number of used chunks of the current
+///     interval, the allocation failures and the chunk fill histogram are updated with relaxed atomics. The minimum
+///     and maximum are derived from the value returned by the atomic increment of the used chunks and are updated
+///     with a CAS loop, therefore no concurrent getChunk call can be lost. The values of a MemPoolInfo are not a
+///     consistent snapshot of all counters, but every counter on its own is exact.
 class MemPool
 {
   public:
     using freeList_t = concurrent::MpmcLoFFLi;
     static constexpr uint64_t CHUNK_MEMORY_ALIGNMENT = 8U; // default alignment for 64 bit
 
+    /// @brief Creates a MemPool
+    /// @param[in] chunkSize is the size of a chunk, must be a multiple of CHUNK_MEMORY_ALIGNMENT
+    /// @param[in] numberOfChunks is the number of chunks of the MemPool
+    /// @param[in] managementAllocator provides the memory for the free list and the chunk caches
+    /// @param[in] chunkMemoryAllocator provides the memory for the chunks
+    /// @param[in] chunkCacheDepth is the number of chunks a thread can cache, 0 disables the chunk caches; it is
+    /// limited to MAX_CHUNK_CACHE_DEPTH
     MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
             const greater_or_equal<uint32_t, 1> numberOfChunks,
             iox::BumpAllocator& managementAllocator,
-            iox::BumpAllocator& chunkMemoryAllocator) noexcept;
+            iox::BumpAllocator& chunkMemoryAllocator,
+            const uint32_t chunkCacheDepth = 0U) noexcept;
+
+    ~MemPool() noexcept;
 
     MemPool(const MemPool&) = delete;
     MemPool(MemPool&&) = delete;
@@ -66,10 +103,31 @@ class MemPool
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
+    uint32_t getMaxUsedChunksInInterval() const noexcept;
+    uint64_t getAllocationFailures() const noexcept;
     MemPoolInfo getInfo() const noexcept;
+    uint32_t getChunkCacheDepth() const noexcept;
+
+    /// @brief Returns the statistics of the MemPool and starts a new interval for the maximum number of used chunks
+    /// @return the statistics of the MemPool
+    MemPoolInfo collectInfo() noexcept;
+
+    /// @brief Adds an allocation to the chunk fill histogram
+    /// @param[in] requiredChunkSize is the chunk size which was requested for a chunk of this MemPool
+    void recordChunkFill(const uint64_t requiredChunkSize) noexcept;
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Returns the chunks in the caches of all threads of a process to the free list and releases the caches
+    /// @param[in] pid of the process
+    /// @note must only be called when the process does not use the MemPool anymore, e.g. when it terminated abnormally
+    void reclaimChunkCaches(const uint32_t pid) noexcept;
+
+    /// @brief Calculates the management memory which is required for the chunk caches of a MemPool
+    /// @param[in] chunkCacheDepth is the depth of the chunk caches
+    /// @return the required memory size
+    static uint64_t requiredChunkCacheMemorySize(const uint32_t chunkCacheDepth) noexcept;
+
     /// @brief Converts an index to a chunk in the MemPool to a pointer
     /// @param[in] index of the chunk
     /// @param[in] chunkSize is the size of the chunk
@@ -86,8 +144,15 @@ class MemPool
     pointerToIndex(const void* const chunk, const uint64_t chunkSize, const void* const rawMemoryBase) noexcept;
 
   private:
-    void adjustMinFree() noexcept;
+    class ThreadLocalChunkCaches;
+
+    void adjustMinFreeAndMaxUsed(const uint32_t usedChunks) noexcept;
     bool isMultipleOfAlignment(const uint64_t value) const noexcept;
+    bool popFreeIndex(uint32_t& index) noexcept;
+    void pushFreeIndex(const uint32_t index) noexcept;
+    void pushToFreeList(const uint32_t index) noexcept;
+    ChunkCache* acquireChunkCache(const ChunkCache::Owner_t owner) noexcept;
+    void releaseChunkCache(ChunkCache& chunkCache) noexcept;
 
     RelativePointer<void> m_rawMemory;
 
@@ -98,8 +163,15 @@ class MemPool
 
     concurrent::Atomic<uint32_t> m_usedChunks{0U};
     concurrent::Atomic<uint32_t> m_minFree{0U};
+    concurrent::Atomic<uint32_t> m_maxUsedInInterval{0U};
+    concurrent::Atomic<uint64_t> m_allocationFailures{0U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) the histogram is placed in shared memory
+    concurrent::Atomic<uint64_t> m_chunkFillHistogram[NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS];
 
     freeList_t m_freeIndices;
+
+    uint32_t m_chunkCacheDepth{0U};
+    RelativePointer<ChunkCache> m_chunkCaches;
 };
 
 } // namespace mepoo
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
@@ -42,8 +43,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = range<uint64_t, 1, std::numeric_limits<uint64_t>::max() - sizeof(ChunkHeader)>;
@@ -76,6 +75,16 @@ class MemoryManager
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
+    /// @brief Returns the statistics of a mempool and starts a new interval for its maximum number of used chunks
+    /// @param[in] index of the mempool
+    /// @return the statistics of the mempool or an empty MemPoolInfo if the index is out of range
+    MemPoolInfo collectMemPoolInfo(const uint32_t index) noexcept;
+
+    /// @brief Returns the chunks in the chunk caches of all threads of a process to the mempools
+    /// @param[in] pid of the process
+    /// @note must only be called when the process does not use the mempools anymore, e.g. when it terminated abnormally
+    void reclaimChunkCaches(const uint32_t pid) noexcept;
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
@@ -83,17 +92,28 @@ class MemoryManager
   private:
     static uint64_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
 
+    /// @brief Searches the mempool with the smallest chunk size which is at least the required chunk size
+    /// @param[in] requiredChunkSize is the chunk size which is required
+    /// @return the index of the mempool or the number of mempools if no mempool is large enough
+    uint32_t findMemPoolIndex(const uint64_t requiredChunkSize) const noexcept;
+
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(BumpAllocator& managementAllocator,
                     BumpAllocator& chunkMemoryAllocator,
                     const greater_or_equal<uint64_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                    const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
+                    const greater_or_equal<uint32_t, 1> numberOfChunks,
+                    const uint32_t chunkCacheDepth = 0U) noexcept;
     void generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept;
 
   private:
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    uint32_t m_maxChunkCacheDepth{0};
+    SizeClassLookup m_sizeClassLookup{SizeClassLookup::BINARY_SEARCH};
+    MemPoolOverflowPolicy m_overflowPolicy{MemPoolOverflowPolicy::FAIL};
 
+    /// the chunk sizes of the mempools are stored separately in order to search them without touching the mempools
+    vector<uint64_t, MAX_NUMBER_OF_MEMPOOLS> m_chunkSizes;
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     vector<MemPool, 1> m_chunkManagementPool;
 };
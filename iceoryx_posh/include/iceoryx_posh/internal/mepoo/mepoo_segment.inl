@@ -94,6 +94,10 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
             .accessMode(AccessMode::ReadWrite)
             .openMode(OpenMode::PurgeAndCreate)
             .permissions(SEGMENT_PERMISSIONS)
+            .prefault(mempoolConfig.m_segmentMemoryOptions.m_prefault)
+            .numberOfZeroingThreads(mempoolConfig.m_segmentMemoryOptions.m_zeroingThreads)
+            .transparentHugePages(mempoolConfig.m_segmentMemoryOptions.m_transparentHugePages)
+            .lockMemory(mempoolConfig.m_segmentMemoryOptions.m_lockMemory)
             .create()
             .and_then([this](auto& sharedMemoryObject) {
                 auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
@@ -88,6 +88,10 @@ class SegmentManager
     SegmentMappingContainer getSegmentMappings(const PosixUser& user) noexcept;
     SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const PosixUser& user) noexcept;
 
+    /// @brief Returns the chunks in the chunk caches of a process to the mempools of all segments
+    /// @param[in] pid of the process which does not use the segments anymore
+    void reclaimChunkCaches(const uint32_t pid) noexcept;
+
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredFullMemorySize(const SegmentConfig& config) noexcept;
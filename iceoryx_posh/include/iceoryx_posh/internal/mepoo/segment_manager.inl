@@ -139,6 +139,15 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const P
     return segmentInfo;
 }
 
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::reclaimChunkCaches(const uint32_t pid) noexcept
+{
+    for (auto& segment : m_segmentContainer)
+    {
+        segment.getMemoryManager().reclaimChunkCaches(pid);
+    }
+}
+
 template <typename SegmentType>
 uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const SegmentConfig& config) noexcept
 {
@@ -127,6 +127,9 @@ class BaseSubscriber
     /// port
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> takeChunk() noexcept;
 
+    /// @brief small helper method to forward the 'tryGetChunks' method of the port
+    expected<uint64_t, ChunkReceiveResult> takeChunks(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept;
+
     void invalidateTrigger(const uint64_t trigger) noexcept;
 
     /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
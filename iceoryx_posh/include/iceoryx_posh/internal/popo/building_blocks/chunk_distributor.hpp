@@ -20,11 +20,16 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iox/deadline_timer.hpp"
 #include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/unique_id.hpp"
+#include "iox/duration.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <thread>
 
@@ -61,6 +66,29 @@ enum class ChunkDistributorError
 /// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
 /// We would need a container like the UsedChunkList to have one that is robust against such inconsistencies....
 /// A perfect job for our future selves
+///
+/// With QueueDeliveryMode::LOCK_FREE_SNAPSHOT, deliverToAllStoredQueues does not take the lock for the stored queues
+/// but iterates over an epoch protected snapshot of them. The snapshot is updated with the lock held whenever a queue
+/// is added or removed and the update only returns after all readers of the outdated snapshot left it, i.e. a removed
+/// queue is not used anymore once tryRemoveQueue returned. A reader which was terminated while iterating over the
+/// snapshot delays the updates by QUEUE_SNAPSHOT_GRACE_PERIOD until RouDi cleans up the port. The history is still
+/// protected by the lock, i.e. the delivery is only completely lock-free with a history capacity of 0.
+///
+/// About blocking producers:
+/// With ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER and a full queue with QueueFullPolicy::BLOCK_PRODUCER, the producer
+/// registers itself at the queue and waits on its space available condition variable which is notified by the
+/// ChunkQueuePopper whenever a chunk is taken from the queue. The wait is bounded by BLOCKED_PRODUCER_WAKEUP_TIMEOUT
+/// to recover from consumers which were terminated. While a producer waits, it keeps the queue alive either by
+/// holding the queue snapshot or by being counted in m_numberOfProducersWaitingForSpace, i.e. removing a queue waits
+/// at most BLOCKED_PRODUCER_WAKEUP_TIMEOUT for the blocked producers. The time the producers were blocked is recorded
+/// in the m_blockedDeliveryLatencyHistogram.
+///
+/// About batches:
+/// deliverBatchToAllStoredQueues pushes all chunks of a batch to a queue before it continues with the next queue and
+/// notifies every queue only once per batch. The stored queues are accessed with a single lock acquisition (or a single
+/// snapshot acquisition with QueueDeliveryMode::LOCK_FREE_SNAPSHOT) as long as no producer has to wait for a consumer.
+/// When a queue with QueueFullPolicy::BLOCK_PRODUCER is full, the remaining chunks of the batch are delivered to it one
+/// after another like with deliverToAllStoredQueues, i.e. every queue receives the chunks in the order of the batch.
 template <typename ChunkDistributorDataType>
 class ChunkDistributor
 {
@@ -69,6 +97,14 @@ class ChunkDistributor
     using ChunkQueueData_t = typename ChunkDistributorDataType::ChunkQueueData_t;
     using ChunkQueuePusher_t = typename ChunkDistributorDataType::ChunkQueuePusher_t;
 
+    /// @brief the time a queue snapshot update waits for the readers of the outdated snapshot before it assumes that
+    /// they were terminated
+    static constexpr units::Duration QUEUE_SNAPSHOT_GRACE_PERIOD{units::Duration::fromMilliseconds(100U)};
+
+    /// @brief the maximum time a blocked producer waits for a notification from the consumer before it checks the
+    /// queues again
+    static constexpr units::Duration BLOCKED_PRODUCER_WAKEUP_TIMEOUT{units::Duration::fromMilliseconds(10U)};
+
     explicit ChunkDistributor(not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept;
 
     ChunkDistributor(const ChunkDistributor& other) = delete;
@@ -104,6 +140,12 @@ class ChunkDistributor
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks to all the stored chunk queues with a single notification per queue.
+    /// The chunks will be added to the chunk history
+    /// @param[in] chunks are the SharedChunks to be delivered in this order
+    /// @return the number of deliveries, i.e. the sum of the number of queues each chunk was delivered to
+    uint64_t deliverBatchToAllStoredQueues(const span<const mepoo::SharedChunk> chunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
@@ -145,7 +187,90 @@ class ChunkDistributor
 
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
+    uint64_t deliverToAllStoredQueuesWithoutLock(mepoo::SharedChunk chunk) noexcept;
+
+    uint64_t deliverBatchToAllStoredQueuesWithoutLock(const span<const mepoo::SharedChunk> chunks) noexcept;
+
+    /// @brief A queue with QueueFullPolicy::BLOCK_PRODUCER which was full during the delivery of a batch
+    struct PendingQueue
+    {
+        RelativePointer<ChunkQueueData_t> queue;
+        /// @brief the index of the first chunk of the batch which was not delivered to the queue
+        uint64_t firstUndeliveredChunk{0U};
+    };
+    using PendingQueueContainer_t =
+        vector<PendingQueue, ChunkDistributorDataType::ChunkDistributorDataProperties_t::MAX_QUEUES>;
+
+    /// @brief Pushes all chunks to the queues and notifies each queue once. Must only be called with the lock held or
+    /// with an acquired queue snapshot.
+    /// @param[in] queues to deliver to
+    /// @param[in] chunks to deliver
+    /// @param[out] pendingQueues the queues which are still waiting for the remaining chunks of the batch
+    /// @return the number of deliveries
+    uint64_t pushBatchToQueues(const typename MemberType_t::QueueContainer_t& queues,
+                               const span<const mepoo::SharedChunk> chunks,
+                               PendingQueueContainer_t& pendingQueues) noexcept;
+
+    /// @brief Collects the pending queues which still need the chunk with the provided index of the batch
+    static void collectQueuesAwaitingChunk(const PendingQueueContainer_t& pendingQueues,
+                                           const uint64_t chunkIndex,
+                                           typename MemberType_t::QueueContainer_t& fullQueues) noexcept;
+
+    /// @brief Retries the delivery to the full queues until all of them which are still stored are served. Takes the
+    /// lock for every retry and waits without the lock.
+    /// @return the number of queues the chunk was delivered to
+    uint64_t waitUntilFullQueuesAreServed(typename MemberType_t::QueueContainer_t& fullQueues,
+                                          mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Retries the delivery to the full queues until all of them which are still in the snapshot are served.
+    /// Acquires a new queue snapshot after every wait.
+    /// @param[in, out] snapshotIndex the index of the acquired queue snapshot
+    /// @return the number of queues the chunk was delivered to
+    uint64_t waitUntilFullQueuesAreServedWithoutLock(typename MemberType_t::QueueContainer_t& fullQueues,
+                                                     mepoo::SharedChunk chunk,
+                                                     uint64_t& snapshotIndex) noexcept;
+
+    /// @brief Copies the stored queues into the inactive snapshot, activates it and waits until the readers of the
+    /// outdated snapshot are gone. Must only be called with the lock held.
+    void updateQueueSnapshot() noexcept;
+
+    /// @brief Registers the caller as reader of the currently active queue snapshot
+    /// @return the index of the queue snapshot which must be passed to releaseQueueSnapshot
+    uint64_t acquireQueueSnapshot() noexcept;
+
+    void releaseQueueSnapshot(const uint64_t snapshotIndex) noexcept;
+
+    /// @brief Registers the caller as blocked producer of a full queue and retries the delivery, i.e. either the retry
+    /// succeeds or the consumer sees the registration when it frees space in the queue. Must only be called while
+    /// the queue cannot be removed, i.e. with the lock held or with an acquired queue snapshot.
+    /// @return true if the chunk was delivered, false if the caller is registered as blocked producer
+    bool pushToQueueOrRegisterAsBlockedProducer(ChunkQueueData_t* const queue, mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Retries the delivery to the full queues which are still stored and registers the caller as blocked
+    /// producer of the first queue which is still full. Must only be called with the lock held or with an acquired
+    /// queue snapshot.
+    /// @param[in, out] fullQueues the queues which are still full afterwards
+    /// @param[in] storedQueues the currently stored queues
+    /// @param[in] chunk to deliver
+    /// @return the number of queues the chunk was delivered to
+    uint64_t retryDeliveryToFullQueues(typename MemberType_t::QueueContainer_t& fullQueues,
+                                       const typename MemberType_t::QueueContainer_t& storedQueues,
+                                       mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Waits until the consumer frees space in the queue or BLOCKED_PRODUCER_WAKEUP_TIMEOUT expired and
+    /// deregisters the caller as blocked producer of the queue
+    void waitForSpaceAvailable(ChunkQueueData_t* const queue) noexcept;
+
   private:
+    /// @brief Adds the chunk to the history. Must only be called with the lock held and a history capacity > 0.
+    void pushToHistory(mepoo::SharedChunk chunk) noexcept;
+
+    void waitForQueueSnapshotReaders(const uint64_t snapshotIndex) noexcept;
+    void wakeUpBlockedProducers(ChunkQueueData_t* const queue) noexcept;
+    void waitForBlockedProducers() noexcept;
+    void waitForGracePeriod(const concurrent::Atomic<uint64_t>& numberOfUsers) noexcept;
+    static units::Duration currentMonotonicTime() noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
@@ -85,6 +85,11 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
                 pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
             }
 
+            if (getMembers()->m_deliveryMode == QueueDeliveryMode::LOCK_FREE_SNAPSHOT)
+            {
+                updateQueueSnapshot();
+            }
+
             return ok();
         }
         else
@@ -114,6 +119,13 @@ ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueDa
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
         getMembers()->m_queues.erase(iter);
 
+        wakeUpBlockedProducers(queueToRemove);
+        if (getMembers()->m_deliveryMode == QueueDeliveryMode::LOCK_FREE_SNAPSHOT)
+        {
+            updateQueueSnapshot();
+        }
+        waitForBlockedProducers();
+
         return ok();
     }
     else
@@ -127,7 +139,17 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    for (auto& queue : getMembers()->m_queues)
+    {
+        wakeUpBlockedProducers(queue.get());
+    }
     getMembers()->m_queues.clear();
+
+    if (getMembers()->m_deliveryMode == QueueDeliveryMode::LOCK_FREE_SNAPSHOT)
+    {
+        updateQueueSnapshot();
+    }
+    waitForBlockedProducers();
 }
 
 template <typename ChunkDistributorDataType>
@@ -141,8 +163,13 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
+    if (getMembers()->m_deliveryMode == QueueDeliveryMode::LOCK_FREE_SNAPSHOT)
+    {
+        return deliverToAllStoredQueuesWithoutLock(chunk);
+    }
+
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
-    using QueueContainer = decltype(getMembers()->m_queues);
+    using QueueContainer = typename MemberType_t::QueueContainer_t;
     QueueContainer fullQueuesAwaitingDelivery;
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
@@ -172,60 +199,408 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
         }
     }
 
-    // busy waiting until every queue is served
-    iox::detail::adaptive_wait adaptiveWait;
-    while (!fullQueuesAwaitingDelivery.empty())
+    // wait until every queue is served
+    if (!fullQueuesAwaitingDelivery.empty())
+    {
+        const auto blockingStart = currentMonotonicTime();
+        numberOfQueuesTheChunkWasDeliveredTo += waitUntilFullQueuesAreServed(fullQueuesAwaitingDelivery, chunk);
+        getMembers()->m_blockedDeliveryLatencyHistogram.record(currentMonotonicTime() - blockingStart);
+    }
+
+    addToHistoryWithoutDelivery(chunk);
+
+    return numberOfQueuesTheChunkWasDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::waitUntilFullQueuesAreServed(
+    typename MemberType_t::QueueContainer_t& fullQueues, mepoo::SharedChunk chunk) noexcept
+{
+    uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
+    while (!fullQueues.empty())
     {
-        adaptiveWait.wait();
         {
-            // create intersection of current queues and fullQueuesAwaitingDelivery
+            // only deliver to the queues which are still stored
             // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
+            //          and without this check we would deliver to dead queues
             typename MemberType_t::LockGuard_t lock(*getMembers());
-            QueueContainer remainingQueues;
-            using QueueContainerValue = typename QueueContainer::value_type;
-            auto greaterThan = [](QueueContainerValue& a, QueueContainerValue& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#endif
-            std::sort(fullQueuesAwaitingDelivery.begin(), fullQueuesAwaitingDelivery.end(), greaterThan);
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic pop
-#endif
-
-            std::set_intersection(getMembers()->m_queues.begin(),
-                                  getMembers()->m_queues.end(),
-                                  fullQueuesAwaitingDelivery.begin(),
-                                  fullQueuesAwaitingDelivery.end(),
-                                  std::back_inserter(remainingQueues),
-                                  greaterThan);
-            fullQueuesAwaitingDelivery.clear();
-
-            // deliver to remaining queues
-            for (auto& queue : remainingQueues)
+            numberOfQueuesTheChunkWasDeliveredTo +=
+                retryDeliveryToFullQueues(fullQueues, getMembers()->m_queues, chunk);
+            if (fullQueues.empty())
             {
-                if (pushToQueue(queue.get(), chunk))
-                {
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                }
-                else
-                {
-                    fullQueuesAwaitingDelivery.push_back(queue);
-                }
+                break;
+            }
+            // keeps the queue alive while waiting without the lock, see waitForBlockedProducers
+            getMembers()->m_numberOfProducersWaitingForSpace.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        waitForSpaceAvailable(fullQueues.front().get());
+        getMembers()->m_numberOfProducersWaitingForSpace.fetch_sub(1U, std::memory_order_release);
+    }
+    return numberOfQueuesTheChunkWasDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverBatchToAllStoredQueues(
+    const span<const mepoo::SharedChunk> chunks) noexcept
+{
+    if (getMembers()->m_deliveryMode == QueueDeliveryMode::LOCK_FREE_SNAPSHOT)
+    {
+        return deliverBatchToAllStoredQueuesWithoutLock(chunks);
+    }
+
+    uint64_t numberOfDeliveries{0U};
+    PendingQueueContainer_t pendingQueues;
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        numberOfDeliveries = pushBatchToQueues(getMembers()->m_queues, chunks, pendingQueues);
+    }
+
+    // deliver the remaining chunks one after another to the queues which were full
+    if (!pendingQueues.empty())
+    {
+        const auto blockingStart = currentMonotonicTime();
+        for (uint64_t i = 0U; i < chunks.size(); ++i)
+        {
+            typename MemberType_t::QueueContainer_t fullQueues;
+            collectQueuesAwaitingChunk(pendingQueues, i, fullQueues);
+            numberOfDeliveries += waitUntilFullQueuesAreServed(fullQueues, chunks[i]);
+        }
+        getMembers()->m_blockedDeliveryLatencyHistogram.record(currentMonotonicTime() - blockingStart);
+    }
+
+    if (0U < getMembers()->m_historyCapacity)
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        for (const auto& chunk : chunks)
+        {
+            pushToHistory(chunk);
+        }
+    }
+
+    return numberOfDeliveries;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverBatchToAllStoredQueuesWithoutLock(
+    const span<const mepoo::SharedChunk> chunks) noexcept
+{
+    uint64_t numberOfDeliveries{0U};
+    PendingQueueContainer_t pendingQueues;
+
+    auto snapshotIndex = acquireQueueSnapshot();
+    numberOfDeliveries = pushBatchToQueues(getMembers()->m_queueSnapshots[snapshotIndex], chunks, pendingQueues);
+
+    // deliver the remaining chunks one after another to the queues which were full
+    if (!pendingQueues.empty())
+    {
+        const auto blockingStart = currentMonotonicTime();
+        for (uint64_t i = 0U; i < chunks.size(); ++i)
+        {
+            typename MemberType_t::QueueContainer_t fullQueues;
+            collectQueuesAwaitingChunk(pendingQueues, i, fullQueues);
+            numberOfDeliveries += waitUntilFullQueuesAreServedWithoutLock(fullQueues, chunks[i], snapshotIndex);
+        }
+        getMembers()->m_blockedDeliveryLatencyHistogram.record(currentMonotonicTime() - blockingStart);
+    }
+    releaseQueueSnapshot(snapshotIndex);
+
+    if (0U < getMembers()->m_historyCapacity)
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        for (const auto& chunk : chunks)
+        {
+            pushToHistory(chunk);
+        }
+    }
+
+    return numberOfDeliveries;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::pushBatchToQueues(const typename MemberType_t::QueueContainer_t& queues,
+                                                              const span<const mepoo::SharedChunk> chunks,
+                                                              PendingQueueContainer_t& pendingQueues) noexcept
+{
+    uint64_t numberOfDeliveries{0U};
+    bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    for (auto& queue : queues)
+    {
+        bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+        ChunkQueuePusher_t pusher(queue.get());
+        for (uint64_t i = 0U; i < chunks.size(); ++i)
+        {
+            if (pusher.pushWithoutNotification(chunks[i]))
+            {
+                ++numberOfDeliveries;
+            }
+            else if (isBlockingQueue)
+            {
+                // the remaining chunks must not overtake the one which did not fit into the queue
+                pendingQueues.emplace_back(PendingQueue{queue, i});
+                break;
+            }
+            else
+            {
+                ++numberOfDeliveries;
+                pusher.lostAChunk();
+            }
+        }
+        pusher.notify();
+    }
+    return numberOfDeliveries;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::collectQueuesAwaitingChunk(
+    const PendingQueueContainer_t& pendingQueues,
+    const uint64_t chunkIndex,
+    typename MemberType_t::QueueContainer_t& fullQueues) noexcept
+{
+    for (const auto& pendingQueue : pendingQueues)
+    {
+        if (pendingQueue.firstUndeliveredChunk <= chunkIndex)
+        {
+            fullQueues.emplace_back(pendingQueue.queue);
+        }
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueuesWithoutLock(mepoo::SharedChunk chunk) noexcept
+{
+    uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
+    using QueueContainer = typename MemberType_t::QueueContainer_t;
+    QueueContainer fullQueuesAwaitingDelivery;
+
+    bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+    auto snapshotIndex = acquireQueueSnapshot();
+    // send to all the queues
+    for (auto& queue : getMembers()->m_queueSnapshots[snapshotIndex])
+    {
+        bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+        if (pushToQueue(queue.get(), chunk))
+        {
+            ++numberOfQueuesTheChunkWasDeliveredTo;
+        }
+        else
+        {
+            if (isBlockingQueue)
+            {
+                fullQueuesAwaitingDelivery.emplace_back(queue);
+            }
+            else
+            {
+                ++numberOfQueuesTheChunkWasDeliveredTo;
+                ChunkQueuePusher_t(queue.get()).lostAChunk();
             }
         }
     }
 
+    // wait until every queue is served
+    if (!fullQueuesAwaitingDelivery.empty())
+    {
+        const auto blockingStart = currentMonotonicTime();
+        numberOfQueuesTheChunkWasDeliveredTo +=
+            waitUntilFullQueuesAreServedWithoutLock(fullQueuesAwaitingDelivery, chunk, snapshotIndex);
+        getMembers()->m_blockedDeliveryLatencyHistogram.record(currentMonotonicTime() - blockingStart);
+    }
+    releaseQueueSnapshot(snapshotIndex);
+
     addToHistoryWithoutDelivery(chunk);
 
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::waitUntilFullQueuesAreServedWithoutLock(
+    typename MemberType_t::QueueContainer_t& fullQueues, mepoo::SharedChunk chunk, uint64_t& snapshotIndex) noexcept
+{
+    uint64_t numberOfQueuesTheChunkWasDeliveredTo =
+        retryDeliveryToFullQueues(fullQueues, getMembers()->m_queueSnapshots[snapshotIndex], chunk);
+    while (!fullQueues.empty())
+    {
+        // the acquired snapshot keeps the queue alive while waiting
+        waitForSpaceAvailable(fullQueues.front().get());
+        releaseQueueSnapshot(snapshotIndex);
+        snapshotIndex = acquireQueueSnapshot();
+
+        // only deliver to the queues which are still in the current snapshot
+        // reason: it is possible that since the last iteration some subscriber have already unsubscribed
+        //          and without this check we would deliver to dead queues
+        numberOfQueuesTheChunkWasDeliveredTo +=
+            retryDeliveryToFullQueues(fullQueues, getMembers()->m_queueSnapshots[snapshotIndex], chunk);
+    }
+    return numberOfQueuesTheChunkWasDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::updateQueueSnapshot() noexcept
+{
+    auto& members = *getMembers();
+    // the epoch is only modified with the lock held, therefore a relaxed load is sufficient
+    const auto epoch = members.m_queueSnapshotEpoch.load(std::memory_order_relaxed);
+    const auto activeIndex = epoch % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+    const auto nextIndex = (epoch + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+
+    // readers which registered themselves on the inactive snapshot just before the previous update are rejected by
+    // the epoch check in acquireQueueSnapshot but they might still be in the process of deregistering
+    waitForQueueSnapshotReaders(nextIndex);
+
+    members.m_queueSnapshots[nextIndex] = members.m_queues;
+    members.m_queueSnapshotEpoch.store(epoch + 1U, std::memory_order_seq_cst);
+
+    // grace period; after this, no reader uses a queue which is not in m_queues anymore
+    waitForQueueSnapshotReaders(activeIndex);
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::acquireQueueSnapshot() noexcept
+{
+    auto& members = *getMembers();
+    while (true)
+    {
+        const auto epoch = members.m_queueSnapshotEpoch.load(std::memory_order_seq_cst);
+        const auto snapshotIndex = epoch % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+        members.m_queueSnapshotReaders[snapshotIndex].fetch_add(1U, std::memory_order_seq_cst);
+
+        // if the epoch changed in the meantime, the writer might not have seen this reader and could already
+        // overwrite the snapshot; in this case we retry with the new epoch
+        if (members.m_queueSnapshotEpoch.load(std::memory_order_seq_cst) == epoch)
+        {
+            return snapshotIndex;
+        }
+        members.m_queueSnapshotReaders[snapshotIndex].fetch_sub(1U, std::memory_order_seq_cst);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseQueueSnapshot(const uint64_t snapshotIndex) noexcept
+{
+    getMembers()->m_queueSnapshotReaders[snapshotIndex].fetch_sub(1U, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::waitForQueueSnapshotReaders(const uint64_t snapshotIndex) noexcept
+{
+    waitForGracePeriod(getMembers()->m_queueSnapshotReaders[snapshotIndex]);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::waitForBlockedProducers() noexcept
+{
+    waitForGracePeriod(getMembers()->m_numberOfProducersWaitingForSpace);
+}
+
+template <typename ChunkDistributorDataType>
+inline units::Duration ChunkDistributor<ChunkDistributorDataType>::currentMonotonicTime() noexcept
+{
+    return units::Duration::fromNanoseconds(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::waitForGracePeriod(
+    const concurrent::Atomic<uint64_t>& numberOfUsers) noexcept
+{
+    deadline_timer gracePeriod(QUEUE_SNAPSHOT_GRACE_PERIOD);
+    iox::detail::adaptive_wait adaptiveWait;
+    while (numberOfUsers.load(std::memory_order_seq_cst) > 0U)
+    {
+        if (gracePeriod.hasExpired())
+        {
+            IOX_LOG(Warn,
+                    "The users of the stored queues did not finish within the grace period! Assuming that they were "
+                    "terminated.");
+            return;
+        }
+        adaptiveWait.wait();
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::wakeUpBlockedProducers(ChunkQueueData_t* const queue) noexcept
+{
+    if (queue->m_spaceAvailableConditionVariableData.has_value()
+        && queue->m_numberOfBlockedProducers.load(std::memory_order_seq_cst) > 0U)
+    {
+        ConditionNotifier(*queue->m_spaceAvailableConditionVariableData,
+                          ChunkQueueData_t::SPACE_AVAILABLE_NOTIFICATION_INDEX)
+            .notify();
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueueOrRegisterAsBlockedProducer(
+    ChunkQueueData_t* const queue, mepoo::SharedChunk chunk) noexcept
+{
+    // pairs with the fence in ChunkQueuePopper::notifyBlockedProducers; either the consumer sees the registration or
+    // the retry sees the space which was freed by the consumer
+    queue->m_numberOfBlockedProducers.fetch_add(1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (pushToQueue(queue, chunk))
+    {
+        queue->m_numberOfBlockedProducers.fetch_sub(1U, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::retryDeliveryToFullQueues(
+    typename MemberType_t::QueueContainer_t& fullQueues,
+    const typename MemberType_t::QueueContainer_t& storedQueues,
+    mepoo::SharedChunk chunk) noexcept
+{
+    uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
+    typename MemberType_t::QueueContainer_t remainingQueues;
+    for (auto& queue : fullQueues)
+    {
+        const auto isStillStored =
+            std::any_of(storedQueues.begin(), storedQueues.end(), [&](const RelativePointer<ChunkQueueData_t>& q) {
+                return q.get() == queue.get();
+            });
+        if (!isStillStored)
+        {
+            continue;
+        }
+
+        // only the first remaining queue is waited for, the others are just retried
+        const auto isDelivered = remainingQueues.empty() ? pushToQueueOrRegisterAsBlockedProducer(queue.get(), chunk)
+                                                         : pushToQueue(queue.get(), chunk);
+        if (isDelivered)
+        {
+            ++numberOfQueuesTheChunkWasDeliveredTo;
+        }
+        else
+        {
+            remainingQueues.emplace_back(queue);
+        }
+    }
+    fullQueues = remainingQueues;
+
+    return numberOfQueuesTheChunkWasDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::waitForSpaceAvailable(ChunkQueueData_t* const queue) noexcept
+{
+    // the notifications are not evaluated since the queues are checked again anyway
+    IOX_DISCARD_RESULT(ConditionListener(*queue->m_spaceAvailableConditionVariableData)
+                           .timedWait(BLOCKED_PRODUCER_WAKEUP_TIMEOUT));
+    queue->m_numberOfBlockedProducers.fetch_sub(1U, std::memory_order_relaxed);
+}
+
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<ChunkQueueData_t* const> queue,
                                                                     mepoo::SharedChunk chunk) noexcept
@@ -239,37 +614,61 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
                                                            const uint32_t lastKnownQueueIndex,
                                                            mepoo::SharedChunk chunk [[maybe_unused]]) noexcept
 {
-    bool retry{false};
+    optional<units::Duration> blockingStart;
+    ChunkQueueData_t* queueToWaitFor{nullptr};
     do
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        {
+            typename MemberType_t::LockGuard_t lock(*getMembers());
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+            auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
 
-        if (!queueIndex.has_value())
-        {
-            return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
-        }
+            if (!queueIndex.has_value())
+            {
+                return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+            }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+            auto& queue = getMembers()->m_queues[queueIndex.value()];
 
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+            bool willWaitForConsumer =
+                getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
 
-        bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+            bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-        retry = false;
-        if (!pushToQueue(queue.get(), chunk))
-        {
-            if (isBlockingQueue)
+            queueToWaitFor = nullptr;
+            if (!pushToQueue(queue.get(), chunk))
             {
-                retry = true;
+                if (isBlockingQueue)
+                {
+                    if (!pushToQueueOrRegisterAsBlockedProducer(queue.get(), chunk))
+                    {
+                        queueToWaitFor = queue.get();
+                        // keeps the queue alive while waiting without the lock, see waitForBlockedProducers
+                        getMembers()->m_numberOfProducersWaitingForSpace.fetch_add(1U, std::memory_order_relaxed);
+                    }
+                }
+                else
+                {
+                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                }
             }
-            else
+        }
+
+        if (queueToWaitFor != nullptr)
+        {
+            if (!blockingStart.has_value())
             {
-                ChunkQueuePusher_t(queue.get()).lostAChunk();
+                blockingStart.emplace(currentMonotonicTime());
             }
+            waitForSpaceAvailable(queueToWaitFor);
+            getMembers()->m_numberOfProducersWaitingForSpace.fetch_sub(1U, std::memory_order_release);
         }
-    } while (retry);
+    } while (queueToWaitFor != nullptr);
+
+    if (blockingStart.has_value())
+    {
+        getMembers()->m_blockedDeliveryLatencyHistogram.record(currentMonotonicTime() - blockingStart.value());
+    }
 
     return ok();
 }
@@ -303,21 +702,28 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQ
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
+    // the history capacity is const, therefore the lock is only required if there is a history at all
     if (0u < getMembers()->m_historyCapacity)
     {
-        if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
-        {
-            auto chunkToRemove = getMembers()->m_history.begin();
-            chunkToRemove->releaseToSharedChunk();
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we are not iterating here, so return value can be ignored
-            getMembers()->m_history.erase(chunkToRemove);
-        }
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in the
-        // history, so return value can be ignored
-        getMembers()->m_history.push_back(chunk);
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        pushToHistory(chunk);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::pushToHistory(mepoo::SharedChunk chunk) noexcept
+{
+    if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
+    {
+        auto chunkToRemove = getMembers()->m_history.begin();
+        chunkToRemove->releaseToSharedChunk();
+        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we are not iterating here, so return value can be
+        // ignored
+        getMembers()->m_history.erase(chunkToRemove);
     }
+    // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in
+    // the history, so return value can be ignored
+    getMembers()->m_history.push_back(chunk);
 }
 
 template <typename ChunkDistributorDataType>
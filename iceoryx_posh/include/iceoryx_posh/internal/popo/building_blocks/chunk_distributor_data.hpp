@@ -19,9 +19,11 @@
 
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/algorithm.hpp"
+#include "iox/atomic.hpp"
 #include "iox/logging.hpp"
 #include "iox/mutex.hpp"
 #include "iox/relative_pointer.hpp"
@@ -43,13 +45,36 @@ struct ChunkDistributorData : public LockingPolicy
     using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
     using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
 
-    ChunkDistributorData(const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
+    ChunkDistributorData(const ConsumerTooSlowPolicy policy,
+                         const uint64_t historyCapacity = 0u,
+                         const QueueDeliveryMode deliveryMode = QueueDeliveryMode::LOCKED) noexcept;
 
     const uint64_t m_historyCapacity;
 
     using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
     QueueContainer_t m_queues;
 
+    /// @brief Double buffered copy of m_queues which is used by the QueueDeliveryMode::LOCK_FREE_SNAPSHOT delivery.
+    /// The snapshots are only written with the lock held; the active one is selected by the parity of
+    /// m_queueSnapshotEpoch and m_queueSnapshotReaders counts the readers which are currently iterating over the
+    /// corresponding snapshot. Since readers do not hold any lock, a terminated reader can at most delay a writer by
+    /// the grace period but never block it forever.
+    static constexpr uint64_t NUMBER_OF_QUEUE_SNAPSHOTS{2U};
+    // NOLINTJUSTIFICATION the snapshots are accessed by the epoch parity which is always in bounds
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    QueueContainer_t m_queueSnapshots[NUMBER_OF_QUEUE_SNAPSHOTS];
+    concurrent::Atomic<uint64_t> m_queueSnapshotEpoch{0U};
+    // NOLINTJUSTIFICATION see m_queueSnapshots
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    concurrent::Atomic<uint64_t> m_queueSnapshotReaders[NUMBER_OF_QUEUE_SNAPSHOTS];
+    const QueueDeliveryMode m_deliveryMode;
+
+    /// @brief Number of producers which wait for space in a queue with QueueFullPolicy::BLOCK_PRODUCER while not
+    /// holding the lock. A queue must not be removed while a producer waits on its condition variable.
+    concurrent::Atomic<uint64_t> m_numberOfProducersWaitingForSpace{0U};
+    /// @brief The time producers were blocked by full queues until the chunk was delivered
+    LatencyHistogram m_blockedDeliveryLatencyHistogram;
+
     /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
     /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
@@ -44,12 +44,20 @@ struct ChunkQueueData : public LockingPolicy
     UniqueId m_uniqueId{};
 
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
+    static constexpr uint64_t SPACE_AVAILABLE_NOTIFICATION_INDEX{0U};
     VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
     concurrent::Atomic<bool> m_queueHasLostChunks{false};
 
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief Only available with QueueFullPolicy::BLOCK_PRODUCER; the consumer notifies this condition variable
+    /// whenever it frees space in the queue while a producer is blocked
+    optional<ConditionVariableData> m_spaceAvailableConditionVariableData;
+    /// @brief Number of producers which wait for space in the queue; while it is not zero the queue must not be
+    /// destroyed since the producers use m_spaceAvailableConditionVariableData
+    concurrent::Atomic<uint64_t> m_numberOfBlockedProducers{0U};
 };
 
 } // namespace popo
@@ -27,6 +27,10 @@ inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(const
     : m_queue(queueType)
     , m_queueFullPolicy(policy)
 {
+    if (m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER)
+    {
+        m_spaceAvailableConditionVariableData.emplace();
+    }
 }
 
 } // namespace popo
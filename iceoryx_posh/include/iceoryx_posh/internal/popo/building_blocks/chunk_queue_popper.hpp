@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -50,6 +51,12 @@ class ChunkQueuePopper
     /// @return optional for a shared chunk that is set if the queue is not empty
     optional<mepoo::SharedChunk> tryPop() noexcept;
 
+    /// @brief pop up to 'chunks.size()' chunks from the chunk queue with a single update of the queue read position
+    ///        and a single wake-up of blocked producers
+    /// @param[out] chunks storage for the pop'ed chunks in the order of their insertion
+    /// @return the number of pop'ed chunks which are stored at the beginning of 'chunks'
+    uint64_t tryPopBatch(const span<mepoo::SharedChunk> chunks) noexcept;
+
     /// @brief check if chunks were lost and reset flag
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
@@ -96,6 +103,10 @@ class ChunkQueuePopper
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+  private:
+    /// @brief wakes up a producer which waits for space in the queue, if there is any
+    void notifyBlockedProducers() noexcept;
+
   private:
     MemberType_t* m_chunkQueueDataPtr;
 };
@@ -19,7 +19,9 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/logging.hpp"
+#include "iox/uninitialized_array.hpp"
 
 namespace iox
 {
@@ -53,6 +55,8 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        notifyBlockedProducers();
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
         auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
@@ -74,6 +78,44 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     }
 }
 
+template <typename ChunkQueueDataType>
+inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::tryPopBatch(const span<mepoo::SharedChunk> chunks) noexcept
+{
+    UninitializedArray<mepoo::ShmSafeUnmanagedChunk, MemberType_t::MAX_CAPACITY> unmanagedChunks;
+    const auto maxNumberOfChunks = algorithm::minVal(chunks.size(), MemberType_t::MAX_CAPACITY);
+    const auto numberOfPoppedChunks =
+        getMembers()->m_queue.popBatch(span<mepoo::ShmSafeUnmanagedChunk>(&unmanagedChunks[0], maxNumberOfChunks));
+
+    if (numberOfPoppedChunks == 0U)
+    {
+        return 0U;
+    }
+
+    notifyBlockedProducers();
+
+    uint64_t numberOfChunks{0U};
+    for (uint64_t i = 0U; i < numberOfPoppedChunks; ++i)
+    {
+        auto chunk = unmanagedChunks[i].releaseToSharedChunk();
+
+        auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
+        if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+        {
+            IOX_LOG(Error,
+                    "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion << "' but expected '"
+                                                                 << mepoo::ChunkHeader::CHUNK_HEADER_VERSION
+                                                                 << "'! Dropping chunk!");
+            IOX_REPORT(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
+                       iox::er::RUNTIME_ERROR);
+            continue;
+        }
+        chunks[numberOfChunks] = chunk;
+        ++numberOfChunks;
+    }
+
+    return numberOfChunks;
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
@@ -124,6 +166,7 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
         // side effect here and return value does not need to be evaluated
         maybeUnmanagedChunk.value().releaseToSharedChunk();
     }
+    notifyBlockedProducers();
 }
 
 template <typename ChunkQueueDataType>
@@ -151,6 +194,25 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const
     return getMembers()->m_conditionVariableDataPtr.operator bool();
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::notifyBlockedProducers() noexcept
+{
+    auto& spaceAvailableConditionVariableData = getMembers()->m_spaceAvailableConditionVariableData;
+    if (!spaceAvailableConditionVariableData.has_value())
+    {
+        return;
+    }
+
+    // pairs with the increment of m_numberOfBlockedProducers before the producer retries to push; either the producer
+    // sees the freed space or we see the blocked producer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_numberOfBlockedProducers.load(std::memory_order_relaxed) > 0U)
+    {
+        ConditionNotifier(*spaceAvailableConditionVariableData, MemberType_t::SPACE_AVAILABLE_NOTIFICATION_INDEX)
+            .notify();
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -50,6 +50,15 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push a new chunk to the chunk queue without notifying the consumer, e.g. to push a batch of chunks with
+    /// a single notification; notify must be called afterwards
+    /// @param[in] shared chunk object
+    /// @return false if a queue overflow occurred, otherwise true
+    bool pushWithoutNotification(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief notify the consumer that chunks were pushed to the chunk queue
+    void notify() noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
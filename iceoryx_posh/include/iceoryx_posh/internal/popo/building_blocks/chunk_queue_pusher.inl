@@ -44,6 +44,14 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
+{
+    const bool hasNoQueueOverflow = pushWithoutNotification(chunk);
+    notify();
+    return hasNoQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::SharedChunk chunk) noexcept
 {
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
@@ -56,17 +64,19 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notify() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (getMembers()->m_conditionVariableDataPtr)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
-        {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
-        }
+        ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                          *getMembers()->m_conditionVariableNotificationIndex)
+            .notify();
     }
-
-    return !hasQueueOverflow;
 }
 
 template <typename ChunkQueueDataType>
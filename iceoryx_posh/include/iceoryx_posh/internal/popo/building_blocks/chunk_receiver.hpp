@@ -22,6 +22,7 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -78,6 +79,15 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Tries to get up to 'chunkHeaders.size()' received chunks at once. The chunks are removed from the
+    /// underlying queue with a single update of the read position and registered in one pass. Like with tryGet, the
+    /// ownership of the SharedChunks remains in the ChunkReceiver
+    /// @param[out] chunkHeaders storage for the ChunkHeaders of the received chunks in the order of their arrival
+    /// @return the number of received chunks which are stored at the beginning of 'chunkHeaders', ChunkReceiveResult
+    /// if no chunk could be received; the number of chunks is limited by the chunks which can still be held in parallel
+    /// and no chunk is dropped if this limit is already reached
+    expected<uint64_t, ChunkReceiveResult> tryGetBatch(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -19,6 +19,8 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -93,6 +95,40 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
     return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline expected<uint64_t, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetBatch(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept
+{
+    auto& chunksInUse = getMembers()->m_chunksInUse;
+
+    // if the application holds too many chunks, don't provide more; in contrast to tryGet the chunks remain in the
+    // queue since it is known upfront how many chunks can be taken
+    const uint64_t maxNumberOfChunks =
+        algorithm::minVal(chunkHeaders.size(), static_cast<uint64_t>(chunksInUse.freeSlots()));
+    if (maxNumberOfChunks == 0U)
+    {
+        return (chunkHeaders.size() == 0U || this->empty()) ? err(ChunkReceiveResult::NO_CHUNK_AVAILABLE)
+                                                            : err(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+
+    vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_IN_USE> chunks;
+    chunks.resize(maxNumberOfChunks);
+    const auto numberOfChunks = this->tryPopBatch(span<mepoo::SharedChunk>(chunks.data(), maxNumberOfChunks));
+    if (numberOfChunks == 0U)
+    {
+        return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+
+    // cannot fail since the number of chunks is limited by the free slots
+    chunksInUse.insert(span<const mepoo::SharedChunk>(chunks.data(), numberOfChunks));
+
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        chunkHeaders[i] = chunks[i].getChunkHeader();
+    }
+    return ok(numberOfChunks);
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
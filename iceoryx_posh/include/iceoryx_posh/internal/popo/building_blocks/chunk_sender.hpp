@@ -28,6 +28,7 @@
 #include "iox/into.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -114,6 +115,12 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send allocated chunks to all connected ChunkQueuePopper with a single notification per ChunkQueuePopper
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send in this order; the ownership of the pointers is
+    /// transferred to this method
+    /// @return the sum of the number of receivers each chunk was send to
+    uint64_t sendBatch(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
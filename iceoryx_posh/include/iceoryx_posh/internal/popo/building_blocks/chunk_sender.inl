@@ -195,6 +195,36 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t
+ChunkSender<ChunkSenderDataType>::sendBatch(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    uint64_t numberOfDeliveries{0};
+    // there cannot be more valid chunks than chunks in use
+    vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY> chunks;
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    for (auto* const chunkHeader : chunkHeaders)
+    {
+        mepoo::SharedChunk chunk(nullptr);
+        if (getChunkReadyForSend(chunkHeader, chunk))
+        {
+            chunks.emplace_back(chunk);
+        }
+    }
+
+    if (!chunks.empty())
+    {
+        numberOfDeliveries =
+            this->deliverBatchToAllStoredQueues(span<const mepoo::SharedChunk>(chunks.begin(), chunks.size()));
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunks.back();
+    }
+    // END of critical section
+
+    return numberOfDeliveries;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const UniqueId uniqueQueueId,
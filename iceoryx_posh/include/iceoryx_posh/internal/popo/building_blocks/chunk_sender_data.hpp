@@ -36,9 +36,11 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const QueueDeliveryMode deliveryMode = QueueDeliveryMode::LOCKED) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
+    static constexpr uint32_t MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY{MaxChunksAllocatedSimultaneously};
 
     const RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
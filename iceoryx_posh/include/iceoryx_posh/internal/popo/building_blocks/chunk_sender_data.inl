@@ -26,8 +26,9 @@ inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataTyp
     not_null<mepoo::MemoryManager* const> memoryManager,
     const ConsumerTooSlowPolicy consumerTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity)
+    const mepoo::MemoryInfo& memoryInfo,
+    const QueueDeliveryMode deliveryMode) noexcept
+    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity, deliveryMode)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
 {
@@ -70,9 +70,12 @@ class ConditionListener
     ConditionVariableData* getMembers() volatile noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
     void resetSemaphore() noexcept;
 
+    /// @brief polls the semaphore up to CONDITION_LISTENER_SPIN_ITERATIONS times before the caller goes to sleep
+    /// @return true if the semaphore could be decremented while spinning, otherwise false
+    bool spinOnSemaphore() noexcept;
+
     NotificationVector_t waitImpl(const function_ref<bool()> waitCall) noexcept;
 
   private:
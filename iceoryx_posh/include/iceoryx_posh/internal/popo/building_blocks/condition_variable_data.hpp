@@ -21,6 +21,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/atomic.hpp"
+#include "iox/futex_semaphore.hpp"
 #include "iox/spin_semaphore.hpp"
 #include "iox/unnamed_semaphore.hpp"
 
@@ -30,6 +31,12 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    /// @brief the active notifications are stored as bits in 64 bit words; a notifier sets its bit with a single
+    /// 'fetch_or' and the listener collects all notifications of a word with a single 'exchange'
+    static constexpr uint64_t NOTIFICATIONS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{(MAX_NUMBER_OF_NOTIFIERS + NOTIFICATIONS_PER_WORD - 1U)
+                                                          / NOTIFICATIONS_PER_WORD};
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -42,8 +49,16 @@ struct ConditionVariableData
     optional<build::InterProcessSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     concurrent::Atomic<bool> m_toBeDestroyed{false};
-    concurrent::Atomic<bool> m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    concurrent::Atomic<uint64_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
     concurrent::Atomic<bool> m_wasNotified{false};
+
+    /// @brief marks the notification with the given index as active
+    /// @param[in] index of the notification, must be less than MAX_NUMBER_OF_NOTIFIERS
+    void setNotification(const uint64_t index) noexcept;
+
+    /// @brief checks if the notification with the given index is active
+    /// @param[in] index of the notification, must be less than MAX_NUMBER_OF_NOTIFIERS
+    bool isNotificationActive(const uint64_t index) const noexcept;
 };
 
 } // namespace popo
@@ -0,0 +1,45 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iox/atomic.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Shared between RouDi and the ports to run the discovery only when a port has a pending CaPro message or
+/// shall be destroyed. A port sets its own request flag, then the flag for all ports and finally notifies the
+/// condition variable RouDi is waiting on.
+struct DiscoveryNotificationData
+{
+    /// @brief notification index which is used by the ports
+    static constexpr uint64_t PORT_NOTIFICATION_INDEX{0U};
+    /// @brief notification index which is used by RouDi to trigger the discovery loop manually
+    static constexpr uint64_t TRIGGER_NOTIFICATION_INDEX{1U};
+
+    ConditionVariableData m_conditionVariableData;
+    concurrent::Atomic<bool> m_portDiscoveryRequested{true};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
@@ -0,0 +1,73 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/atomic.hpp"
+#include "iox/duration.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Histogram with logarithmic buckets which can be placed in the shared memory and updated concurrently
+///        without a lock. Bucket 0 counts the latencies below 1us, bucket i counts the latencies in the range
+///        [2^(i-1)us, 2^i us[ and the last bucket additionally counts all latencies which are beyond the range.
+class LatencyHistogram
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_BUCKETS{NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS};
+
+    LatencyHistogram() noexcept;
+    ~LatencyHistogram() noexcept = default;
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+
+    /// @brief adds a latency sample to the corresponding bucket
+    /// @param[in] latency to record
+    void record(const units::Duration& latency) noexcept;
+
+    /// @brief returns the number of recorded samples in a bucket
+    /// @param[in] bucketIndex of the bucket, must be less than NUMBER_OF_BUCKETS
+    /// @return the number of samples in the bucket or 0 if the index is out of range
+    uint64_t count(const uint32_t bucketIndex) const noexcept;
+
+    /// @brief returns the number of all recorded samples
+    uint64_t totalCount() const noexcept;
+
+    /// @brief resets all buckets to zero
+    void reset() noexcept;
+
+    /// @brief calculates the bucket a latency belongs to
+    /// @param[in] latency for which the bucket shall be calculated
+    /// @return the index of the bucket
+    static uint32_t bucketIndex(const units::Duration& latency) noexcept;
+
+  private:
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) the buckets are placed in shared memory
+    concurrent::Atomic<uint64_t> m_buckets[NUMBER_OF_BUCKETS];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
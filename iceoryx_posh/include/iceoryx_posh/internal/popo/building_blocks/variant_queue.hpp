@@ -18,11 +18,14 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_VARIANT_QUEUE_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_VARIANT_QUEUE_HPP
 
+#include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/assertions.hpp"
+#include "iox/detail/mpmc_lockfree_queue.hpp"
 #include "iox/detail/mpmc_resizeable_lockfree_queue.hpp"
 #include "iox/detail/spsc_fifo.hpp"
 #include "iox/detail/spsc_sofi.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 #include "iox/variant.hpp"
 
 #include <cstdint>
@@ -42,12 +45,30 @@ enum class VariantQueueTypes : uint64_t
     FiFo_SingleProducerSingleConsumer = 0,
     SoFi_SingleProducerSingleConsumer = 1,
     FiFo_MultiProducerSingleConsumer = 2,
-    SoFi_MultiProducerSingleConsumer = 3
+    SoFi_MultiProducerSingleConsumer = 3,
+    FiFo_MultiProducerSingleConsumer_FixedCapacity = 4,
+    SoFi_MultiProducerSingleConsumer_FixedCapacity = 5
 };
 
-// remark: we need to consider to support the non-resizable queue as well
-//         since it should have performance benefits if resize is not actually needed
-//         for now we just use the most general variant, which allows resizing
+/// @brief selects the multi producer queue type for a queue with the given capacity
+/// @param[in] policy of the queue when it is full
+/// @param[in] capacity which is requested for the queue
+/// @param[in] maxCapacity of the queue, i.e. the capacity of the underlying storage
+/// @return the non-resizable queue type if the requested capacity is the maximum capacity since it avoids the capacity
+///         bookkeeping of the resizable queue on every push and pop, otherwise the resizable queue type
+constexpr VariantQueueTypes multiProducerQueueType(const QueueFullPolicy policy,
+                                                   const uint64_t capacity,
+                                                   const uint64_t maxCapacity) noexcept
+{
+    if (capacity == maxCapacity)
+    {
+        return (policy == QueueFullPolicy::DISCARD_OLDEST_DATA)
+                   ? VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity
+                   : VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity;
+    }
+    return (policy == QueueFullPolicy::DISCARD_OLDEST_DATA) ? VariantQueueTypes::SoFi_MultiProducerSingleConsumer
+                                                            : VariantQueueTypes::FiFo_MultiProducerSingleConsumer;
+}
 
 /// @brief wrapper of multiple fifo's
 /// @param[in] ValueType type which should be stored
@@ -74,7 +95,9 @@ class VariantQueue
     using fifo_t = variant<concurrent::SpscFifo<ValueType, Capacity>,
                            concurrent::SpscSofi<ValueType, Capacity>,
                            concurrent::MpmcResizeableLockFreeQueue<ValueType, Capacity>,
-                           concurrent::MpmcResizeableLockFreeQueue<ValueType, Capacity>>;
+                           concurrent::MpmcResizeableLockFreeQueue<ValueType, Capacity>,
+                           concurrent::MpmcLockFreeQueue<ValueType, Capacity>,
+                           concurrent::MpmcLockFreeQueue<ValueType, Capacity>>;
 
     /// @brief Constructor of a VariantQueue
     /// @param[in] type type of the underlying queue
@@ -92,6 +115,13 @@ class VariantQueue
     ///         otherwise the optional contains nullopt_t
     optional<ValueType> pop() noexcept;
 
+    /// @brief pops up to 'values.size()' elements from the fifo
+    /// @param[out] values storage for the pop'ed elements in the order of their insertion
+    /// @return the number of pop'ed elements which are stored at the beginning of 'values'
+    /// @note the SPSC queues update their read position only once for the whole batch while the MPSC queues
+    ///       pop the elements one by one
+    uint64_t popBatch(const span<ValueType> values) noexcept;
+
     /// @brief returns true if empty otherwise true
     bool empty() const noexcept;
 
@@ -107,6 +137,7 @@ class VariantQueue
     ///         this call
     /// @note depending on the internal queue used, concurrent pushes and pops are possible
     ///       (for FiFo_MultiProducerSingleConsumer and SoFi_MultiProducerSingleConsumer)
+    /// @note the fixed capacity queues only accept their maximum capacity
     /// @concurrent not thread safe
     bool setCapacity(const uint64_t newCapacity) noexcept;
 
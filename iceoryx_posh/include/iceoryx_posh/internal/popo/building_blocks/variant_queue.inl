@@ -48,6 +48,13 @@ inline VariantQueue<ValueType, Capacity>::VariantQueue(const VariantQueueTypes t
         m_fifo.template emplace<concurrent::MpmcResizeableLockFreeQueue<ValueType, Capacity>>();
         break;
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+        [[fallthrough]];
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        m_fifo.template emplace<concurrent::MpmcLockFreeQueue<ValueType, Capacity>>();
+        break;
+    }
     }
 }
 
@@ -91,6 +98,22 @@ optional<ValueType> VariantQueue<ValueType, Capacity>::push(const ValueType& val
             VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
         return queue->push(value);
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        auto hadSpace = queue->tryPush(value);
+
+        return (hadSpace) ? nullopt : make_optional<ValueType>(value);
+    }
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        return queue->push(value);
+    }
     }
 
     return nullopt;
@@ -126,11 +149,81 @@ inline optional<ValueType> VariantQueue<ValueType, Capacity>::pop() noexcept
             VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
         return queue->pop();
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        return queue->pop();
+    }
     }
 
     return nullopt;
 }
 
+template <typename ValueType, uint64_t Capacity>
+inline uint64_t VariantQueue<ValueType, Capacity>::popBatch(const span<ValueType> values) noexcept
+{
+    switch (m_type)
+    {
+    case VariantQueueTypes::FiFo_SingleProducerSingleConsumer:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_SingleProducerSingleConsumer)>();
+        return queue->popBatch(values);
+    }
+    case VariantQueueTypes::SoFi_SingleProducerSingleConsumer:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::SoFi_SingleProducerSingleConsumer)>();
+        return queue->popBatch(values);
+    }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
+        uint64_t numberOfValues{0U};
+        while (numberOfValues < values.size())
+        {
+            auto value = queue->pop();
+            if (!value.has_value())
+            {
+                break;
+            }
+            values[numberOfValues] = value.value();
+            ++numberOfValues;
+        }
+        return numberOfValues;
+    }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        uint64_t numberOfValues{0U};
+        while (numberOfValues < values.size())
+        {
+            auto value = queue->pop();
+            if (!value.has_value())
+            {
+                break;
+            }
+            values[numberOfValues] = value.value();
+            ++numberOfValues;
+        }
+        return numberOfValues;
+    }
+    }
+
+    return 0U;
+}
+
 template <typename ValueType, uint64_t Capacity>
 inline bool VariantQueue<ValueType, Capacity>::empty() const noexcept
 {
@@ -158,6 +251,14 @@ inline bool VariantQueue<ValueType, Capacity>::empty() const noexcept
             VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
         return queue->empty();
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        return queue->empty();
+    }
     }
 
     return true;
@@ -190,6 +291,14 @@ inline uint64_t VariantQueue<ValueType, Capacity>::size() noexcept
             VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
         return queue->size();
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        return queue->size();
+    }
     }
 
     return 0U;
@@ -223,6 +332,15 @@ inline bool VariantQueue<ValueType, Capacity>::setCapacity(const uint64_t newCap
         // we may discard elements in the queue if the size is reduced and the fifo contains too many elements
         return queue->setCapacity(newCapacity);
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        // the capacity of the non-resizable queue is fixed at compile time
+        return newCapacity == queue->capacity();
+    }
     }
     return false;
 }
@@ -254,6 +372,14 @@ inline uint64_t VariantQueue<ValueType, Capacity>::capacity() const noexcept
             VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
         return queue->capacity();
     }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity)>();
+        return queue->capacity();
+    }
     }
 
     return 0U;
@@ -71,6 +71,14 @@ class BasePort
     /// @brief Indicate that this port can be destroyed
     void destroy() noexcept;
 
+    /// @brief Requests RouDi to process this port in the next run of the discovery loop and wakes up the loop
+    /// @note Must be called after every change RouDi has to react on, e.g. an offer request or a subscription request
+    void requestDiscovery() noexcept;
+
+    /// @brief Checks whether a discovery was requested and resets the request
+    /// @return true if a discovery was requested since the last call, false otherwise
+    bool acquireDiscoveryRequest() noexcept;
+
     /// @brief Checks whether port can be destroyed
     /// @return true if it shall be destroyed, false if not
     bool toBeDestroyed() const noexcept;
@@ -20,9 +20,11 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iox/atomic.hpp"
 #include "iox/relative_pointer.hpp"
+#include "iox/relocatable_ptr.hpp"
 
 namespace iox
 {
@@ -50,6 +52,12 @@ struct BasePortData
     RuntimeName_t m_runtimeName;
     UniquePortId m_uniqueId;
     concurrent::Atomic<bool> m_toBeDestroyed{false};
+    /// @brief set by the user side when RouDi has to process this port; initially set to process new ports
+    concurrent::Atomic<bool> m_discoveryRequested{true};
+    /// @brief set by RouDi when the port is added to the port pool
+    /// @note the port and the notification data are both located in the management segment, therefore a self
+    ///       relative pointer is used which does not depend on the registration of the segment
+    relocatable_ptr<DiscoveryNotificationData> m_discoveryNotificationDataPtr;
 };
 
 } // namespace popo
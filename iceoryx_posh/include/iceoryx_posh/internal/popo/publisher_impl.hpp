@@ -22,7 +22,9 @@
 #include "iceoryx_posh/internal/popo/publisher_interface.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/span.hpp"
 #include "iox/type_traits.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -57,12 +59,34 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     template <typename... Args>
     expected<Sample<T, H>, AllocationError> loan(Args&&... args) noexcept;
 
+    /// @brief container for the samples of loanBatch; the number of samples is limited by the number of chunks a
+    /// publisher can hold simultaneously
+    using SampleBatch = vector<Sample<T, H>, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY>;
+
+    ///
+    /// @brief loanBatch Get multiple samples from loaned shared memory and construct the data of each one with the
+    /// given arguments.
+    /// @param numberOfSamples The number of samples to loan.
+    /// @param args Arguments used to construct the data of every sample.
+    /// @return The loaned samples or an error if not all of them could be loaned; in this case no sample is loaned.
+    /// @details The loaned samples are automatically released when they go out of scope.
+    ///
+    template <typename... Args>
+    expected<SampleBatch, AllocationError> loanBatch(const uint64_t numberOfSamples, const Args&... args) noexcept;
+
     ///
     /// @brief publish Publishes the given sample and then releases its loan.
     /// @param sample The sample to publish.
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief publishBatch Publishes the given samples in their order and then releases their loans. Every subscriber
+    /// is notified only once for the whole batch.
+    /// @param samples The samples to publish; they are empty afterwards.
+    ///
+    void publishBatch(const span<Sample<T, H>> samples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
@@ -47,6 +47,31 @@ inline expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePublisher
     return loanSample().and_then([&](auto& sample) { new (sample.get()) T(std::forward<Args>(args)...); });
 }
 
+template <typename T, typename H, typename BasePublisherType>
+template <typename... Args>
+inline expected<typename PublisherImpl<T, H, BasePublisherType>::SampleBatch, AllocationError>
+PublisherImpl<T, H, BasePublisherType>::loanBatch(const uint64_t numberOfSamples, const Args&... args) noexcept
+{
+    if (numberOfSamples > SampleBatch::capacity())
+    {
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    SampleBatch samples;
+    for (uint64_t i = 0U; i < numberOfSamples; ++i)
+    {
+        auto result = loanSample();
+        if (result.has_error())
+        {
+            // the already loaned samples are released when 'samples' goes out of scope
+            return err(result.error());
+        }
+        new (result.value().get()) T(args...);
+        samples.emplace_back(std::move(result.value()));
+    }
+    return ok(std::move(samples));
+}
+
 template <typename T, typename H, typename BasePublisherType>
 template <typename Callable, typename... ArgTypes>
 inline expected<void, AllocationError>
@@ -98,6 +123,31 @@ inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sampl
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::publishBatch(const span<Sample<T, H>> samples) noexcept
+{
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (auto& sample : samples)
+    {
+        if (!sample)
+        {
+            continue;
+        }
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+            chunkHeaders.clear();
+        }
+        auto userPayload = sample.release(); // release the Samples ownership of the chunk before publishing
+        chunkHeaders.emplace_back(mepoo::ChunkHeader::fromUserPayload(userPayload));
+    }
+
+    if (!chunkHeaders.empty())
+    {
+        port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+    }
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
@@ -20,6 +20,7 @@
 
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -54,6 +55,19 @@ class SubscriberImpl : public BaseSubscriberType
     ///
     expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
+    /// @brief container for the samples of takeBatch; the number of samples is limited by the number of chunks a
+    /// subscriber can hold simultaneously
+    using SampleBatch = vector<Sample<const T, const H>, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY>;
+
+    ///
+    /// @brief Take up to 'maxNumberOfSamples' samples from the top of the receive queue at once.
+    /// @param maxNumberOfSamples The maximum number of samples to take; it is limited by the capacity of SampleBatch.
+    /// @return Either the samples in the order of their arrival or a ChunkReceiveResult if no sample could be taken.
+    /// @details The receive queue is drained with a single update of its read position. Each sample takes care of its
+    /// own cleanup.
+    ///
+    expected<SampleBatch, ChunkReceiveResult> takeBatch(const uint64_t maxNumberOfSamples) noexcept;
+
   protected:
     using PortType = typename BaseSubscriberType::PortType;
     using BaseSubscriberType::port;
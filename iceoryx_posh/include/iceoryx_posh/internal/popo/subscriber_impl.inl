@@ -19,6 +19,7 @@
 #define IOX_POSH_POPO_TYPED_SUBSCRIBER_IMPL_INL
 
 #include "iceoryx_posh/internal/popo/subscriber_impl.hpp"
+#include "iox/algorithm.hpp"
 
 namespace iox
 {
@@ -53,6 +54,32 @@ inline expected<Sample<const T, const H>, ChunkReceiveResult> SubscriberImpl<T,
     return ok<Sample<const T, const H>>(std::move(samplePtr));
 }
 
+template <typename T, typename H, typename BaseSubscriberType>
+inline expected<typename SubscriberImpl<T, H, BaseSubscriberType>::SampleBatch, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriberType>::takeBatch(const uint64_t maxNumberOfSamples) noexcept
+{
+    vector<const mepoo::ChunkHeader*, SampleBatch::capacity()> chunkHeaders;
+    chunkHeaders.resize(algorithm::minVal(maxNumberOfSamples, SampleBatch::capacity()));
+
+    auto result = BaseSubscriberType::takeChunks(span<const mepoo::ChunkHeader*>(chunkHeaders));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    SampleBatch samples;
+    for (uint64_t i = 0U; i < result.value(); ++i)
+    {
+        auto userPayloadPtr = static_cast<const T*>(chunkHeaders[i]->userPayload());
+        auto samplePtr = iox::unique_ptr<const T>(userPayloadPtr, [this](const T* userPayload) {
+            auto* chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
+            this->port().releaseChunk(chunkHeader);
+        });
+        samples.emplace_back(std::move(samplePtr));
+    }
+    return ok(std::move(samples));
+}
+
 template <typename T, typename H, typename BaseSubscriberType>
 inline SubscriberImpl<T, H, BaseSubscriberType>::~SubscriberImpl() noexcept
 {
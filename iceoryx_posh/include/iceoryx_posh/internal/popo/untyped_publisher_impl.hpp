@@ -20,6 +20,8 @@
 
 #include "iceoryx_posh/internal/popo/base_publisher.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/span.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -62,6 +64,28 @@ class UntypedPublisherImpl : public BasePublisherType
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Get multiple chunks from loaned shared memory.
+    /// @param userPayloads Is filled with the pointers to the user-payloads of the loaned chunks; its size is the
+    ///        number of chunks to loan and must not exceed MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY.
+    /// @param usePayloadSize The expected user-payload size of the chunks.
+    /// @param userPayloadAlignment The expected user-payload alignment of the chunks.
+    /// @return An AllocationError if not all chunks could be loaned; in this case no chunk is loaned.
+    ///
+    expected<void, AllocationError>
+    loanBatch(const span<void*> userPayloads,
+              const uint64_t userPayloadSize,
+              const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+              const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
+              const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
+
+    ///
+    /// @brief Publish the provided memory chunks in their order. Every subscriber is notified only once for the whole
+    ///        batch.
+    /// @param userPayloads Pointers to the user-payloads of the allocated shared memory chunks.
+    ///
+    void publishBatch(const span<void* const> userPayloads) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
@@ -62,6 +62,57 @@ UntypedPublisherImpl<BasePublisherType>::loan(const uint64_t userPayloadSize,
     }
 }
 
+template <typename BasePublisherType>
+inline expected<void, AllocationError>
+UntypedPublisherImpl<BasePublisherType>::loanBatch(const span<void*> userPayloads,
+                                                   const uint64_t userPayloadSize,
+                                                   const uint32_t userPayloadAlignment,
+                                                   const uint32_t userHeaderSize,
+                                                   const uint32_t userHeaderAlignment) noexcept
+{
+    if (userPayloads.size() > MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY)
+    {
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    for (uint64_t i = 0U; i < userPayloads.size(); ++i)
+    {
+        auto result =
+            port().tryAllocateChunk(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+        if (result.has_error())
+        {
+            for (uint64_t j = 0U; j < i; ++j)
+            {
+                release(userPayloads[j]);
+                userPayloads[j] = nullptr;
+            }
+            return err(result.error());
+        }
+        userPayloads[i] = result.value()->userPayload();
+    }
+    return ok();
+}
+
+template <typename BasePublisherType>
+inline void UntypedPublisherImpl<BasePublisherType>::publishBatch(const span<void* const> userPayloads) noexcept
+{
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (auto* const userPayload : userPayloads)
+    {
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+            chunkHeaders.clear();
+        }
+        chunkHeaders.emplace_back(mepoo::ChunkHeader::fromUserPayload(userPayload));
+    }
+
+    if (!chunkHeaders.empty())
+    {
+        port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+    }
+}
+
 template <typename BasePublisherType>
 inline void UntypedPublisherImpl<BasePublisherType>::release(void* const userPayload) noexcept
 {
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iox/expected.hpp"
+#include "iox/span.hpp"
 #include "iox/unique_ptr.hpp"
 
 namespace iox
@@ -57,6 +58,17 @@ class UntypedSubscriberImpl : public BaseSubscriberType
     ///
     expected<const void*, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take up to 'userPayloads.size()' chunks from the top of the receive queue at once.
+    /// @param userPayloads storage for the user-payload pointers of the chunks taken; at most
+    ///        MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY chunks are taken
+    /// @return The number of chunks taken, which are stored in the order of their arrival at the beginning of
+    ///         'userPayloads', or a ChunkReceiveResult if no chunk could be taken.
+    /// @details The receive queue is drained with a single update of its read position. Like with take, each chunk
+    ///          must be manually released by calling 'release'
+    ///
+    expected<uint64_t, ChunkReceiveResult> takeBatch(const span<const void*> userPayloads) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
@@ -19,6 +19,8 @@
 #define IOX_POSH_POPO_UNTYPED_SUBSCRIBER_IMPL_INL
 
 #include "iceoryx_posh/internal/popo/untyped_subscriber_impl.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -48,6 +50,26 @@ inline expected<const void*, ChunkReceiveResult> UntypedSubscriberImpl<BaseSubsc
     return ok(result.value()->userPayload());
 }
 
+template <typename BaseSubscriberType>
+inline expected<uint64_t, ChunkReceiveResult>
+UntypedSubscriberImpl<BaseSubscriberType>::takeBatch(const span<const void*> userPayloads) noexcept
+{
+    vector<const mepoo::ChunkHeader*, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY> chunkHeaders;
+    chunkHeaders.resize(algorithm::minVal(userPayloads.size(), chunkHeaders.capacity()));
+
+    auto result = BaseSubscriber::takeChunks(span<const mepoo::ChunkHeader*>(chunkHeaders));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    for (uint64_t i = 0U; i < result.value(); ++i)
+    {
+        userPayloads[i] = chunkHeaders[i]->userPayload();
+    }
+    return ok(result.value());
+}
+
 template <typename BaseSubscriberType>
 inline void UntypedSubscriberImpl<BaseSubscriberType>::release(const void* const userPayload) noexcept
 {
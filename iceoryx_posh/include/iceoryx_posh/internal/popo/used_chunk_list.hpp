@@ -20,7 +20,9 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/atomic.hpp"
+#include "iox/span.hpp"
 
 #include <cstdint>
 
@@ -28,6 +30,21 @@ namespace iox
 {
 namespace popo
 {
+namespace internal
+{
+/// @brief The index table of the UsedChunkList has at least twice the capacity of the list to keep the probe sequences
+///        short and a power of two capacity to wrap the positions with a mask
+constexpr uint32_t usedChunkListIndexTableCapacity(const uint32_t capacity) noexcept
+{
+    uint32_t tableCapacity{1U};
+    while (tableCapacity < 2U * capacity)
+    {
+        tableCapacity <<= 1U;
+    }
+    return tableCapacity;
+}
+} // namespace internal
+
 /// @brief This class is used to keep track of the chunks currently in use by the application.
 ///        In case the application terminates while holding chunks, this list is used by RouDi to retain ownership of
 ///        the chunks and prevent a chunk leak.
@@ -38,6 +55,10 @@ namespace popo
 ///        accessed. Additionally, the type stored is this array must be less or equal to 64 bit in order to write it
 ///        within one clock cycle to prevent torn writes, which would corrupt the list and could potentially crash
 ///        RouDi.
+///        To find the slot of a chunk in constant time, the slot indices are additionally stored in an open addressing
+///        hash table which is keyed by the address of the ChunkHeader in the runtime. The table and the keys are only
+///        an accelerator for the runtime; RouDi does not read them during cleanup, therefore it does not matter if
+///        they are left in an inconsistent state when the application dies.
 template <uint32_t Capacity>
 class UsedChunkList
 {
@@ -53,13 +74,23 @@ class UsedChunkList
     /// @note only from runtime context
     bool insert(mepoo::SharedChunk chunk) noexcept;
 
-    /// @brief Removes a chunk from the list
+    /// @brief Inserts multiple SharedChunks into the list in one pass
+    /// @param[in] chunks to store in the list
+    /// @return the number of inserted chunks; if the list runs full, only the first chunks are inserted
+    /// @note only from runtime context
+    uint64_t insert(const span<const mepoo::SharedChunk> chunks) noexcept;
+
+    /// @brief Removes a chunk from the list in constant time on average, independent of the number of used slots
     /// @param[in] chunkHeader to look for a corresponding SharedChunk
     /// @param[out] chunk which is removed
     /// @return true if successfully removed, otherwise false if e.g. the chunkHeader was not found in the list
     /// @note only from runtime context
     bool remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Returns the number of chunks which can still be inserted into the list
+    /// @note only from runtime context
+    uint32_t freeSlots() const noexcept;
+
     /// @brief Cleans up all the remaining chunks from the list.
     /// @note from RouDi context once the applications walked the plank. It is unsafe to call this if the application is
     /// still running.
@@ -68,17 +99,26 @@ class UsedChunkList
   private:
     void init() noexcept;
 
+    static uint64_t chunkKey(const mepoo::ChunkHeader* chunkHeader) noexcept;
+    static uint32_t homePosition(const uint64_t key) noexcept;
+    void addToIndexTable(const uint32_t slot, const uint64_t key) noexcept;
+    void removeFromIndexTable(const uint32_t position) noexcept;
+
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
+    static constexpr uint32_t INDEX_TABLE_CAPACITY{internal::usedChunkListIndexTableCapacity(Capacity)};
+    static constexpr uint32_t INDEX_TABLE_MASK{INDEX_TABLE_CAPACITY - 1U};
 
     using DataElement_t = mepoo::ShmSafeUnmanagedChunk;
     static constexpr DataElement_t DATA_ELEMENT_LOGICAL_NULLPTR{};
 
   private:
     concurrent::AtomicFlag m_synchronizer = ATOMIC_FLAG_INIT;
-    uint32_t m_usedListHead{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
+    uint32_t m_numberOfUsedSlots{0u};
     uint32_t m_listIndices[Capacity];
+    uint32_t m_indexTable[INDEX_TABLE_CAPACITY];
+    uint64_t m_chunkKeys[Capacity];
     DataElement_t m_listData[Capacity];
 };
 
@@ -42,16 +42,15 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
     if (hasFreeSpace)
     {
         // get next free entry after freelistHead
-        auto nextFree = m_listIndices[m_freeListHead];
+        auto slot = m_freeListHead;
+        auto nextFree = m_listIndices[slot];
 
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
-
-        m_listData[m_usedListHead] = DataElement_t(chunk);
+        m_listData[slot] = DataElement_t(chunk);
+        addToIndexTable(slot, chunkKey(chunk.getChunkHeader()));
 
         // set freeListHead to the next free entry
         m_freeListHead = nextFree;
+        ++m_numberOfUsedSlots;
 
         m_synchronizer.clear(std::memory_order_release);
         return true;
@@ -63,43 +62,67 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 }
 
 template <uint32_t Capacity>
-bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
+uint64_t UsedChunkList<Capacity>::insert(const span<const mepoo::SharedChunk> chunks) noexcept
 {
-    auto previous = INVALID_INDEX;
+    uint64_t numberOfInsertedChunks{0U};
+    for (const auto& chunk : chunks)
+    {
+        if (m_freeListHead == INVALID_INDEX)
+        {
+            break;
+        }
+
+        // same list operations as for the single insert but the synchronizer is cleared only once
+        auto slot = m_freeListHead;
+        auto nextFree = m_listIndices[slot];
+        m_listData[slot] = DataElement_t(chunk);
+        addToIndexTable(slot, chunkKey(chunk.getChunkHeader()));
+        m_freeListHead = nextFree;
+        ++m_numberOfUsedSlots;
+        ++numberOfInsertedChunks;
+    }
+
+    if (numberOfInsertedChunks > 0U)
+    {
+        m_synchronizer.clear(std::memory_order_release);
+    }
+    return numberOfInsertedChunks;
+}
 
-    // go through usedList with stored chunks
-    for (auto current = m_usedListHead; current != INVALID_INDEX; current = m_listIndices[current])
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
+{
+    // go through the probe sequence of the chunk; it ends at the first empty position of the index table
+    const auto key = chunkKey(chunkHeader);
+    for (auto position = homePosition(key); m_indexTable[position] != INVALID_INDEX;
+         position = (position + 1U) & INDEX_TABLE_MASK)
     {
-        if (!m_listData[current].isLogicalNullptr())
+        const auto slot = m_indexTable[position];
+
+        // does the entry match the one we want to remove?
+        if (m_chunkKeys[slot] == key)
         {
-            // does the entry match the one we want to remove?
-            if (m_listData[current].getChunkHeader() == chunkHeader)
-            {
-                chunk = m_listData[current].releaseToSharedChunk();
-
-                // remove index from used list
-                if (current == m_usedListHead)
-                {
-                    m_usedListHead = m_listIndices[current];
-                }
-                else
-                {
-                    m_listIndices[previous] = m_listIndices[current];
-                }
-
-                // insert index to free list
-                m_listIndices[current] = m_freeListHead;
-                m_freeListHead = current;
-
-                m_synchronizer.clear(std::memory_order_release);
-                return true;
-            }
+            removeFromIndexTable(position);
+            chunk = m_listData[slot].releaseToSharedChunk();
+
+            // insert index to free list
+            m_listIndices[slot] = m_freeListHead;
+            m_freeListHead = slot;
+            --m_numberOfUsedSlots;
+
+            m_synchronizer.clear(std::memory_order_release);
+            return true;
         }
-        previous = current;
     }
     return false;
 }
 
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::freeSlots() const noexcept
+{
+    return Capacity - m_numberOfUsedSlots;
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::cleanup() noexcept
 {
@@ -136,8 +159,18 @@ void UsedChunkList<Capacity>::init() noexcept
     }
 
 
-    m_usedListHead = INVALID_INDEX;
+    for (auto& position : m_indexTable)
+    {
+        position = INVALID_INDEX;
+    }
+
+    for (auto& key : m_chunkKeys)
+    {
+        key = 0U;
+    }
+
     m_freeListHead = 0U;
+    m_numberOfUsedSlots = 0U;
 
     // clear data
     for (auto& data : m_listData)
@@ -148,6 +181,60 @@ void UsedChunkList<Capacity>::init() noexcept
     m_synchronizer.clear(std::memory_order_release);
 }
 
+template <uint32_t Capacity>
+uint64_t UsedChunkList<Capacity>::chunkKey(const mepoo::ChunkHeader* chunkHeader) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the address is only compared and never dereferenced
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(chunkHeader));
+}
+
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::homePosition(const uint64_t key) noexcept
+{
+    // the chunks are aligned, therefore the lower bits of the address carry no information; the multiplication with
+    // the golden ratio spreads the remaining bits over the upper bits which are used as position
+    constexpr uint64_t GOLDEN_RATIO{0x9E3779B97F4A7C15U};
+    constexpr uint64_t ALIGNMENT_BITS{3U};
+    constexpr uint64_t NUMBER_OF_BITS{64U};
+    constexpr uint64_t INDEX_TABLE_BITS{countTrailingZeros(INDEX_TABLE_CAPACITY)};
+
+    return static_cast<uint32_t>(((key >> ALIGNMENT_BITS) * GOLDEN_RATIO) >> (NUMBER_OF_BITS - INDEX_TABLE_BITS))
+           & INDEX_TABLE_MASK;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::addToIndexTable(const uint32_t slot, const uint64_t key) noexcept
+{
+    m_chunkKeys[slot] = key;
+
+    // the table is never full since it has more positions than the list has slots
+    auto position = homePosition(key);
+    while (m_indexTable[position] != INVALID_INDEX)
+    {
+        position = (position + 1U) & INDEX_TABLE_MASK;
+    }
+    m_indexTable[position] = slot;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::removeFromIndexTable(const uint32_t position) noexcept
+{
+    // backward shift deletion; the entries of the following probe sequence are moved into the hole if their home
+    // position is not between the hole and their current position, which keeps the table free of tombstones
+    auto hole = position;
+    for (auto next = (hole + 1U) & INDEX_TABLE_MASK; m_indexTable[next] != INVALID_INDEX;
+         next = (next + 1U) & INDEX_TABLE_MASK)
+    {
+        const auto home = homePosition(m_chunkKeys[m_indexTable[next]]);
+        if (((next - home) & INDEX_TABLE_MASK) >= ((next - hole) & INDEX_TABLE_MASK))
+        {
+            m_indexTable[hole] = m_indexTable[next];
+            hole = next;
+        }
+    }
+    m_indexTable[hole] = INVALID_INDEX;
+}
+
 } // namespace popo
 } // namespace iox
 
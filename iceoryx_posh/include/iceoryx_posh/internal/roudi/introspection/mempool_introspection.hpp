@@ -83,7 +83,7 @@ class MemPoolIntrospection
                                            uint32_t id) noexcept;
 
     /// @brief copy data fro internal struct into interface struct
-    void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
+    void copyMemPoolInfo(MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
 
   private:
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
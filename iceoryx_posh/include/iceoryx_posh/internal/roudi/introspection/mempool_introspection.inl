@@ -150,20 +150,28 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
 // copy data fro internal struct into interface struct
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
 inline void
-MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolInfo(const MemoryManager& memoryManager,
+MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolInfo(MemoryManager& memoryManager,
                                                                                     MemPoolInfoContainer& dest) noexcept
 {
     auto numOfMemPools = memoryManager.getNumberOfMemPools();
     dest = MemPoolInfoContainer(numOfMemPools, MemPoolInfo());
     for (uint32_t i = 0U; i < numOfMemPools; ++i)
     {
-        auto src = memoryManager.getMemPoolInfo(i);
+        // every sample covers the interval since the previous one for the maximum number of used chunks
+        auto src = memoryManager.collectMemPoolInfo(i);
         auto& dst = dest[i];
         dst.m_usedChunks = src.m_usedChunks;
         dst.m_minFreeChunks = src.m_minFreeChunks;
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_chunkPayloadSize = src.m_chunkSize - sizeof(mepoo::ChunkHeader);
+        dst.m_maxUsedChunksInInterval = src.m_maxUsedChunksInInterval;
+        dst.m_allocationFailures = src.m_allocationFailures;
+        for (uint32_t bucket = 0U; bucket < NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS; ++bucket)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) bucket is limited by the array size
+            dst.m_chunkFillHistogram[bucket] = src.m_chunkFillHistogram[bucket];
+        }
     }
 }
 
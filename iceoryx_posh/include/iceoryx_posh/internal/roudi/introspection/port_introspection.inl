@@ -590,11 +590,33 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortInt
 }
 
 template <typename PublisherPort, typename SubscriberPort>
-inline void
-PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortThroughputIntrospectionTopic& topic
-                                                                         [[maybe_unused]]) noexcept
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
+    PortThroughputIntrospectionTopic& topic) noexcept
 {
-    /// @todo iox-#402 re-add port throughput
+    /// @todo iox-#402 re-add port throughput; currently only the blocked delivery latencies are provided
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& pub : m_publisherMap)
+    {
+        for (auto& pair : pub.second)
+        {
+            auto publisherIndex = pair.second;
+            if (publisherIndex >= 0)
+            {
+                auto publisherInfo = m_publisherContainer.iter_from_index(publisherIndex);
+                PortThroughputData throughputData;
+                PublisherPort port(publisherInfo->portData);
+                throughputData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
+
+                const auto& histogram = publisherInfo->portData->m_chunkSenderData.m_blockedDeliveryLatencyHistogram;
+                for (uint32_t i = 0U; i < NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS; ++i)
+                {
+                    throughputData.m_blockedDeliveryLatencyHistogram[i] = histogram.count(i);
+                }
+
+                topic.m_throughputList.emplace_back(throughputData);
+            }
+        }
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
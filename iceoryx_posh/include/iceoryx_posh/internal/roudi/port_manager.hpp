@@ -61,8 +61,13 @@ class PortManager
     /// @todo iox-#518 Remove this later
     void stopPortIntrospection() noexcept;
 
+    /// @brief Processes the ports which requested a discovery, destroys the condition variables which are marked
+    /// for destruction and publishes the changes of the service registry
     void doDiscovery() noexcept;
 
+    /// @brief Returns the data the ports use to wake up the discovery loop
+    popo::DiscoveryNotificationData& discoveryNotificationData() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -191,6 +196,9 @@ class PortManager
     bool isInternal(const capro::ServiceDescription& service) const noexcept;
 
     void publishServiceRegistry() noexcept;
+    bool publishServiceRegistryDeltas() noexcept;
+    void publishServiceRegistrySnapshot() noexcept;
+    void addPendingServiceRegistryChange(const capro::ServiceDescription& service) noexcept;
 
     const ServiceRegistry& serviceRegistry() const noexcept;
 
@@ -201,6 +209,14 @@ class PortManager
     PortIntrospectionType m_portIntrospection;
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryDeltaPublisherPortData;
+
+    // more changes than fit into the deltas between two snapshots are published with a snapshot anyway
+    static constexpr uint32_t MAX_PENDING_SERVICE_REGISTRY_CHANGES{SERVICE_REGISTRY_DELTA_HISTORY
+                                                                   * ServiceRegistry::Delta::CAPACITY};
+    vector<capro::ServiceDescription, MAX_PENDING_SERVICE_REGISTRY_CHANGES> m_pendingServiceRegistryChanges;
+    bool m_havePendingServiceRegistryChangesOverflowed{false};
+    uint32_t m_numberOfDeltasSinceServiceRegistrySnapshot{0U};
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
@@ -65,6 +65,27 @@ class Process
 
     void sendViaIpcChannel(const runtime::IpcMessage& data) noexcept;
 
+    void sendViaIpcChannel(const runtime::IpcBinaryMessage& data) noexcept;
+
+    /// @brief Sends the acknowledgement of a port request with the relative pointer to the port data; the message is
+    /// encoded with the IPC message protocol which was negotiated with the process
+    /// @param [in] acknowledgement is the message type of the acknowledgement
+    /// @param [in] offset of the port data in the segment
+    /// @param [in] segmentId of the segment which contains the port data
+    void sendPortAcknowledgement(const runtime::IpcMessageType acknowledgement,
+                                 const UntypedRelativePointer::offset_t offset,
+                                 const segment_id_underlying_t segmentId) noexcept;
+
+    /// @brief Sends an error response with the IPC message protocol which was negotiated with the process
+    /// @param [in] error which is sent to the process
+    void sendErrorResponse(const runtime::IpcMessageErrorType error) noexcept;
+
+    /// @brief The IPC message protocol version which was negotiated with the process during the registration
+    /// @return runtime::IpcBinaryMessage::TEXT_PROTOCOL_VERSION if the process supports only text messages
+    uint8_t getIpcMessageProtocolVersion() const noexcept;
+
+    void setIpcMessageProtocolVersion(const uint8_t version) noexcept;
+
     /// @brief The session ID which is used to check outdated IPC channel transmissions for this process
     /// @return the session ID for this process
     uint64_t getSessionId() noexcept;
@@ -81,6 +102,7 @@ class Process
     HeartbeatPoolIndexType m_heartbeatPoolIndex;
     PosixUser m_user;
     concurrent::Atomic<uint64_t> m_sessionId{0U};
+    uint8_t m_ipcMessageProtocolVersion{runtime::IpcBinaryMessage::TEXT_PROTOCOL_VERSION};
 };
 
 } // namespace roudi
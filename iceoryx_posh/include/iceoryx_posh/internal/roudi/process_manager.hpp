@@ -73,6 +73,7 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] ipcMessageProtocolVersion is the highest IPC message protocol version the process supports
     /// @return false if process was already registered, true otherwise
     bool registerProcess(const RuntimeName_t& name,
                          const uint32_t pid,
@@ -80,7 +81,8 @@ class ProcessManager : public ProcessManagerInterface
                          const bool isMonitored,
                          const int64_t transmissionTimestamp,
                          const uint64_t sessionId,
-                         const version::VersionInfo& versionInfo) noexcept;
+                         const version::VersionInfo& versionInfo,
+                         const uint8_t ipcMessageProtocolVersion) noexcept;
 
     /// @brief Unregisters a process at the ProcessManager
     /// @param [in] name of the process which wants to unregister
@@ -150,6 +152,12 @@ class ProcessManager : public ProcessManagerInterface
 
     void run() noexcept;
 
+    /// @brief Checks the heartbeats of the monitored processes and removes the processes which are not alive anymore
+    void monitorProcesses() noexcept;
+
+    /// @brief Runs the discovery of the ports which requested it
+    void discoveryUpdate() noexcept override;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
@@ -159,9 +167,6 @@ class ProcessManager : public ProcessManagerInterface
   private:
     optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
-    void monitorProcesses() noexcept;
-    void discoveryUpdate() noexcept override;
-
     /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
     /// @param [in] pid is the host system process id
     /// @param [in] user is user used in the operating system for this process
@@ -169,6 +174,7 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] ipcMessageProtocolVersion is the highest IPC message protocol version the process supports
     /// @return Returns if the process could be added successfully.
     bool addProcess(const RuntimeName_t& name,
                     const uint32_t pid,
@@ -176,7 +182,8 @@ class ProcessManager : public ProcessManagerInterface
                     const bool isMonitored,
                     const int64_t transmissionTimestamp,
                     const uint64_t sessionId,
-                    const version::VersionInfo& versionInfo) noexcept;
+                    const version::VersionInfo& versionInfo,
+                    const uint8_t ipcMessageProtocolVersion) noexcept;
 
     /// @brief Removes the process from the managed client process list, identified by its id.
     /// @param [in] name The process name which should be removed.
@@ -22,7 +22,6 @@
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
-#include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
@@ -32,6 +31,7 @@
 #include "iox/relative_pointer.hpp"
 #include "iox/scope_guard.hpp"
 #include "iox/smart_lock.hpp"
+#include "iox/vector.hpp"
 
 #include <cstdint>
 #include <thread>
@@ -60,7 +60,7 @@ class RouDi
     void triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcept;
 
   protected:
-    /// @brief Starts the thread processing messages from the runtimes
+    /// @brief Starts the threads processing messages from the runtimes
     /// Once this is done, applications can register and Roudi is fully operational.
     void startProcessRuntimeMessagesThread() noexcept;
 
@@ -72,13 +72,22 @@ class RouDi
     virtual void processMessage(const runtime::IpcMessage& message,
                                 const iox::runtime::IpcMessageType& cmd,
                                 const RuntimeName_t& runtimeName) noexcept;
+    /// @brief Handles the port requests of runtimes which negotiated the binary IPC message protocol
+    /// @param [in] message is the received binary message, the runtime name is its first element
+    virtual void processBinaryMessage(runtime::IpcBinaryMessage& message) noexcept;
     virtual void cyclicUpdateHook() noexcept;
     void IpcMessageErrorHandler() noexcept;
 
     version::VersionInfo parseRegisterMessage(const runtime::IpcMessage& message,
                                               uint32_t& pid,
                                               iox_uid_t& userId,
-                                              int64_t& transmissionTimestamp) noexcept;
+                                              int64_t& transmissionTimestamp,
+                                              uint8_t& ipcMessageProtocolVersion) noexcept;
+
+    /// @brief Checks that the runtime name of a received message is neither empty nor contains path separators
+    /// @param [in] runtimeName to check
+    /// @return true if the runtime name is valid, false otherwise
+    static bool isValidRuntimeName(const RuntimeName_t& runtimeName) noexcept;
 
     /// @brief Handles the registration request from process
     /// @param [in] name of the process which wants to register at roudi; this is equal to the IPC channel name
@@ -87,28 +96,31 @@ class RouDi
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] ipcMessageProtocolVersion is the highest IPC message protocol version the process supports
     void registerProcess(const RuntimeName_t& name,
                          const uint32_t pid,
                          const PosixUser user,
                          const int64_t transmissionTimestamp,
                          const uint64_t sessionId,
-                         const version::VersionInfo& versionInfo) noexcept;
+                         const version::VersionInfo& versionInfo,
+                         const uint8_t ipcMessageProtocolVersion) noexcept;
 
     /// @brief Creates a unique ID which can be used to check outdated IPC channel transmissions
     /// @return a unique, monotonic and consecutive increasing number
     static uint64_t getUniqueSessionIdForProcess() noexcept;
 
   private:
-    void processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterface) noexcept;
+    void processRuntimeMessages() noexcept;
 
     void monitorAndDiscoveryUpdate() noexcept;
 
+    void triggerDiscoveryLoop() noexcept;
+
     ScopeGuard m_unregisterRelativePtr{[] { UntypedRelativePointer::unregisterAll(); }};
     const config::RouDiConfig m_roudiConfig;
     concurrent::Atomic<bool> m_runMonitoringAndDiscoveryThread;
     concurrent::Atomic<bool> m_runHandleRuntimeMessageThread;
 
-    popo::UserTrigger m_discoveryLoopTrigger;
     optional<UnnamedSemaphore> m_discoveryFinishedSemaphore;
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
@@ -128,8 +140,9 @@ class RouDi
     concurrent::smart_lock<ProcessManager> m_prcMgr;
 
   private:
+    optional<runtime::IpcInterfaceCreator> m_roudiIpcInterface;
     std::thread m_monitoringAndDiscoveryThread;
-    std::thread m_handleRuntimeMessageThread;
+    vector<std::thread, MAX_RUNTIME_MESSAGES_THREADS> m_handleRuntimeMessageThreads;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
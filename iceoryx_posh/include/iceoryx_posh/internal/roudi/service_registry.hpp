@@ -56,6 +56,17 @@ class ServiceRegistry
         ReferenceCounter_t serverCount{0U};
     };
 
+    /// @brief Changes of the registry between two versions; the entries contain the absolute counters of the changed
+    /// service descriptions and an entry with both counters being zero denotes a removed service description
+    struct Delta
+    {
+        static constexpr uint32_t CAPACITY = iox::SERVICE_REGISTRY_DELTA_CAPACITY;
+
+        uint64_t baseVersion{0U};
+        uint64_t version{0U};
+        vector<ServiceDescriptionEntry, CAPACITY> changes;
+    };
+
     /// @brief Adds a given publisher service description to registry
     /// @param[in] serviceDescription, service to be added
     /// @return ServiceRegistryError, error wrapped in expected
@@ -100,27 +111,102 @@ class ServiceRegistry
     /// @return true when the registry changed since the last call, false otherwise
     bool hasDataChangedSinceLastCall() noexcept;
 
+    /// @brief Returns the version of the registry, which is increased by the owner of the registry whenever
+    /// the changes are published
+    /// @return the current version
+    uint64_t version() const noexcept;
+
+    /// @brief Increases the version of the registry by one
+    void incrementVersion() noexcept;
+
+    /// @brief Applies the changes of a delta to the registry and sets the version of the registry to the version of
+    /// the delta
+    /// @param[in] delta, the changes to apply
+    /// @return true if the delta was applied, false if the base version of the delta does not match the version of
+    /// the registry or the registry ran out of capacity; in the latter case the registry is only partially updated
+    /// and must be replaced by a snapshot
+    bool applyDelta(const Delta& delta) noexcept;
+
   private:
     using Entry_t = optional<ServiceDescriptionEntry>;
     using ServiceDescriptionContainer_t = vector<Entry_t, CAPACITY>;
 
     static constexpr uint32_t NO_INDEX = CAPACITY;
 
+    /// @brief the hash tables use open addressing with linear probing and have twice the capacity of the registry
+    /// to keep the probe sequences short; since the registry is copied into the shared memory for the service
+    /// discovery, the tables store only indices and no pointers
+    static constexpr uint32_t HASH_TABLE_CAPACITY = 2U * CAPACITY;
+    static constexpr uint32_t NO_SLOT = HASH_TABLE_CAPACITY;
+
+    /// @brief the ID strings of a service description which have a secondary index
+    enum class IdString : uint8_t
+    {
+        SERVICE,
+        INSTANCE,
+        EVENT
+    };
+    static constexpr uint32_t NUMBER_OF_ID_STRINGS{3U};
+
+    /// @brief slot of a hash table; in the secondary indices 'entryIndex' is the first entry of a chain of all
+    /// entries which share the same ID string, the chain is sorted by the entry index
+    struct HashSlot
+    {
+        uint32_t entryIndex{NO_INDEX};
+        uint32_t lastEntryIndex{NO_INDEX};
+        uint32_t chainLength{0U};
+        uint32_t hash{0U};
+    };
+    using HashTable_t = HashSlot[HASH_TABLE_CAPACITY];
+
+    /// @brief links of an entry to its neighbours in the chains of the secondary indices
+    struct ChainLinks
+    {
+        // NOLINTBEGIN(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) the registry is copied into shared memory
+        uint32_t next[NUMBER_OF_ID_STRINGS]{NO_INDEX, NO_INDEX, NO_INDEX};
+        uint32_t previous[NUMBER_OF_ID_STRINGS]{NO_INDEX, NO_INDEX, NO_INDEX};
+        // NOLINTEND(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    };
+
     ServiceDescriptionContainer_t m_serviceDescriptions;
+    vector<uint32_t, CAPACITY> m_freeIndices;
 
-    // store the last known free Index (if any is known)
-    // we could use a queue (or stack) here since they are not optimal
-    // for the filling pattern of a vector (prefer entries close to the front)
-    uint32_t m_freeIndex{NO_INDEX};
+    // NOLINTBEGIN(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) the registry is copied into shared memory
+    HashTable_t m_serviceDescriptionIndex;
+    HashTable_t m_idStringIndex[NUMBER_OF_ID_STRINGS];
+    ChainLinks m_chainLinks[CAPACITY];
+    // NOLINTEND(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
 
     bool m_dataChanged{true}; // initially true in order to also get notified of the empty registry
+    uint64_t m_version{0U};
 
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
-
+    uint32_t findIndex(const capro::IdString_t& service,
+                       const capro::IdString_t& instance,
+                       const capro::IdString_t& event) const noexcept;
 
     expected<void, Error> add(const capro::ServiceDescription& serviceDescription,
                               ReferenceCounter_t ServiceDescriptionEntry::*count);
+
+    uint32_t insert(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    void remove(const uint32_t index) noexcept;
+
+    void addToIndices(const uint32_t index) noexcept;
+    void removeFromIndices(const uint32_t index) noexcept;
+
+    uint32_t
+    findIdStringSlot(const IdString idString, const capro::IdString_t& value, const uint32_t hash) const noexcept;
+
+    static const capro::IdString_t& getIdString(const capro::ServiceDescription& serviceDescription,
+                                                const IdString idString) noexcept;
+    static uint32_t hash(const capro::IdString_t& value, const uint32_t seed) noexcept;
+    static uint32_t hash(const capro::ServiceDescription& serviceDescription) noexcept;
+    static uint32_t
+    hash(const capro::IdString_t& service, const capro::IdString_t& instance, const capro::IdString_t& event) noexcept;
+    static void insertIntoHashTable(HashTable_t& table, const HashSlot& slot) noexcept;
+    static void eraseFromHashTable(HashTable_t& table, uint32_t position) noexcept;
 };
 
 } // namespace roudi
@@ -0,0 +1,163 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
+#define IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/string.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace capro
+{
+class ServiceDescription;
+} // namespace capro
+namespace popo
+{
+struct PublisherOptions;
+struct SubscriberOptions;
+struct ClientOptions;
+struct ServerOptions;
+} // namespace popo
+namespace runtime
+{
+enum class IpcMessageType : int32_t;
+struct PortConfigInfo;
+
+/// @brief Binary counterpart of the IpcMessage for the control traffic between the runtimes and RouDi. The entries
+///        are stored in native byte order in a fixed size buffer, strings are prefixed with their length. Since the
+///        IPC channels transfer null-terminated strings, the buffer is transferred as frame which starts with the
+///        FRAME_MARKER followed by the consistent overhead byte stuffing (COBS) encoding of the buffer which does not
+///        contain any zero. Text messages always start with a digit and can therefore be distinguished from frames.
+///
+///        The buffer starts with a header which consists of the protocol version and the IpcMessageType. Like a
+///        stream, the message becomes invalid as soon as an entry does not fit into the buffer or an extraction
+///        reads beyond the stored entries.
+class IpcBinaryMessage
+{
+  public:
+    /// @brief version of the binary protocol; it is negotiated with the 'IpcMessageType::REG' message and 0 stands
+    ///        for the text based IpcMessage
+    static constexpr uint8_t PROTOCOL_VERSION{1U};
+    static constexpr uint8_t TEXT_PROTOCOL_VERSION{0U};
+    static constexpr char FRAME_MARKER{'\x01'};
+
+    /// @brief the frame must fit into the messages of the runtime and RouDi IPC channels including the null-terminator
+    static constexpr uint64_t MAX_FRAME_SIZE{(ROUDI_MESSAGE_SIZE < APP_MESSAGE_SIZE ? ROUDI_MESSAGE_SIZE
+                                                                                     : APP_MESSAGE_SIZE)
+                                             - 1U};
+    /// @brief COBS requires one code byte per block of up to 254 bytes; the frame marker and the code byte of the
+    ///        first block are the remaining overhead
+    static constexpr uint64_t MAX_PAYLOAD_SIZE{MAX_FRAME_SIZE - 2U - MAX_FRAME_SIZE / 254U};
+    static constexpr uint64_t HEADER_SIZE{sizeof(uint8_t) + sizeof(int32_t)};
+
+    using Frame_t = string<MAX_FRAME_SIZE>;
+
+    /// @brief Creates an empty and invalid message which can be filled with decode
+    IpcBinaryMessage() noexcept = default;
+
+    /// @brief Creates a valid message with the header for the provided message type
+    /// @param[in] messageType of the message
+    explicit IpcBinaryMessage(const IpcMessageType messageType) noexcept;
+
+    /// @brief Returns the message type stored in the header or IpcMessageType::NOTYPE if the message is invalid
+    IpcMessageType getMessageType() const noexcept;
+
+    /// @brief Returns true if all entries could be added or extracted and the header is valid
+    bool isValid() const noexcept;
+
+    /// @brief Marks the message as invalid, e.g. when an extracted value is out of range
+    void invalidate() noexcept;
+
+    /// @brief Returns the number of bytes in the buffer, including the header
+    uint64_t size() const noexcept;
+
+    /// @brief Returns true if all entries were extracted
+    bool isFullyExtracted() const noexcept;
+
+    /// @brief Adds an arithmetic value or an enum to the message
+    /// @param[in] value to add
+    template <typename T>
+    IpcBinaryMessage& operator<<(const T& value) noexcept;
+
+    /// @brief Adds a string with its length as prefix to the message
+    /// @param[in] value to add
+    template <uint64_t Capacity>
+    IpcBinaryMessage& operator<<(const string<Capacity>& value) noexcept;
+
+    /// @brief Extracts the next entry as arithmetic value or enum from the message
+    /// @param[out] value which is set if the extraction succeeds
+    template <typename T>
+    IpcBinaryMessage& operator>>(T& value) noexcept;
+
+    /// @brief Extracts the next entry as string from the message; fails if the string exceeds the capacity
+    /// @param[out] value which is set if the extraction succeeds
+    template <uint64_t Capacity>
+    IpcBinaryMessage& operator>>(string<Capacity>& value) noexcept;
+
+    /// @brief Encodes the message into a frame which can be sent over the IPC channels
+    /// @param[out] frame for the encoded message
+    /// @return true if the message is valid and could be encoded, false otherwise
+    bool encode(Frame_t& frame) const noexcept;
+
+    /// @brief Decodes a received frame and resets the extraction to the first entry after the header
+    /// @param[in] frame which was received from the IPC channel, either an iox::string or a std::string
+    /// @return true if the frame has a valid encoding and a header with the supported protocol version
+    template <typename StringType>
+    bool decode(const StringType& frame) noexcept;
+
+    /// @brief Checks whether a received message is a frame of a binary message
+    /// @param[in] message which was received from the IPC channel, either an iox::string or a std::string
+    /// @return true if the message starts with the FRAME_MARKER
+    template <typename StringType>
+    static bool isFrame(const StringType& message) noexcept;
+
+  private:
+    bool write(const void* data, const uint64_t size) noexcept;
+    bool read(void* data, const uint64_t size) noexcept;
+    bool decode(const char* frame, const uint64_t frameSize) noexcept;
+
+  private:
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size buffer to avoid allocations
+    uint8_t m_buffer[MAX_PAYLOAD_SIZE]{};
+    uint64_t m_size{0U};
+    uint64_t m_readPosition{HEADER_SIZE};
+    bool m_isValid{false};
+};
+
+/// @brief Adds/extracts the types which are required to create ports to/from an IpcBinaryMessage; the extraction
+///        invalidates the message if an enum has an out of range value
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const capro::ServiceDescription& service) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, capro::ServiceDescription& service) noexcept;
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::PublisherOptions& options) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::PublisherOptions& options) noexcept;
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::SubscriberOptions& options) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::SubscriberOptions& options) noexcept;
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::ClientOptions& options) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::ClientOptions& options) noexcept;
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::ServerOptions& options) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::ServerOptions& options) noexcept;
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const PortConfigInfo& portConfigInfo) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, PortConfigInfo& portConfigInfo) noexcept;
+
+} // namespace runtime
+} // namespace iox
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.inl"
+
+#endif // IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
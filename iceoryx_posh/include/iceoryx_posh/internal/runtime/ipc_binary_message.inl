@@ -0,0 +1,116 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_INL
+#define IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_INL
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace iox
+{
+namespace runtime
+{
+template <typename T>
+inline IpcBinaryMessage& IpcBinaryMessage::operator<<(const T& value) noexcept
+{
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only arithmetic types and enums can be added to an IpcBinaryMessage");
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        const uint8_t boolValue{value ? 1U : 0U};
+        write(&boolValue, sizeof(boolValue));
+    }
+    else
+    {
+        write(&value, sizeof(T));
+    }
+    return *this;
+}
+
+template <uint64_t Capacity>
+inline IpcBinaryMessage& IpcBinaryMessage::operator<<(const string<Capacity>& value) noexcept
+{
+    static_assert(Capacity <= std::numeric_limits<uint16_t>::max(), "The string length must fit into an uint16_t");
+    const auto length = static_cast<uint16_t>(value.size());
+    if (write(&length, sizeof(length)))
+    {
+        write(value.c_str(), length);
+    }
+    return *this;
+}
+
+template <typename T>
+inline IpcBinaryMessage& IpcBinaryMessage::operator>>(T& value) noexcept
+{
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only arithmetic types and enums can be extracted from an IpcBinaryMessage");
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        uint8_t boolValue{0U};
+        if (read(&boolValue, sizeof(boolValue)))
+        {
+            value = (boolValue != 0U);
+        }
+    }
+    else
+    {
+        T extractedValue{};
+        if (read(&extractedValue, sizeof(T)))
+        {
+            value = extractedValue;
+        }
+    }
+    return *this;
+}
+
+template <uint64_t Capacity>
+inline IpcBinaryMessage& IpcBinaryMessage::operator>>(string<Capacity>& value) noexcept
+{
+    uint16_t length{0U};
+    if (!read(&length, sizeof(length)))
+    {
+        return *this;
+    }
+    if (length > Capacity || m_readPosition + length > m_size)
+    {
+        m_isValid = false;
+        return *this;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the buffer stores the characters of the string
+    value = string<Capacity>(
+        TruncateToCapacity, reinterpret_cast<const char*>(&m_buffer[m_readPosition]), static_cast<uint64_t>(length));
+    m_readPosition += length;
+    return *this;
+}
+
+template <typename StringType>
+inline bool IpcBinaryMessage::decode(const StringType& frame) noexcept
+{
+    return decode(frame.c_str(), frame.size());
+}
+
+template <typename StringType>
+inline bool IpcBinaryMessage::isFrame(const StringType& message) noexcept
+{
+    return !message.empty() && message.c_str()[0] == FRAME_MARKER;
+}
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_INL
@@ -26,6 +26,7 @@
 #include "iceoryx_platform/types.hpp"
 #include "iceoryx_platform/unistd.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iox/deadline_timer.hpp"
 #include "iox/duration.hpp"
@@ -180,6 +181,19 @@ class IpcInterface
     ///         It also returns false if clock_gettime() failed
     bool timedReceive(const units::Duration timeout, IpcMessage& answer) const noexcept;
 
+    /// @brief Receives a binary message from the IPC channel and stores it in answer.
+    /// @param[out] answer If a binary message is received it is stored there.
+    /// @return If the call failed or no valid binary message was received it returns false, otherwise true.
+    bool receive(IpcBinaryMessage& answer) const noexcept;
+
+    /// @brief Tries to receive a text or a binary message from the IPC channel within a specified timeout.
+    /// @param[in] timeout for receiving a message.
+    /// @param[out] answer The text message if a text message was received.
+    /// @param[out] binaryAnswer The binary message if a binary message was received, it is invalid otherwise.
+    /// @return If a valid message of either encoding was received before the timeout occurs it returns true,
+    ///         otherwise false.
+    bool timedReceive(const units::Duration timeout, IpcMessage& answer, IpcBinaryMessage& binaryAnswer) const noexcept;
+
     /// @brief Tries to send the message specified in msg.
     /// @param[in] msg Must be a valid message, if its an invalid message
     ///                 send will return false
@@ -187,6 +201,11 @@ class IpcInterface
     ///             otherwise if the message was invalid it will return false.
     bool send(const IpcMessage& msg) const noexcept;
 
+    /// @brief Tries to send the binary message specified in msg.
+    /// @param[in] msg Must be a valid binary message which fits into a frame, otherwise send will return false
+    /// @return If the message was sent it returns true, otherwise false.
+    bool send(const IpcBinaryMessage& msg) const noexcept;
+
     /// @brief Tries to send the message specified in msg to the message
     ///        queue within a specified timeout.
     /// @param[in] msg Must be a valid message, if its an invalid message
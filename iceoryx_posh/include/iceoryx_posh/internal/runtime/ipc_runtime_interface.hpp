@@ -61,6 +61,17 @@ class IpcRuntimeInterface
     /// @return true if communication was successful, false if not
     bool sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept;
 
+    /// @brief send a binary request to the RouDi daemon; requires a negotiated binary protocol version
+    /// @param[in] msg request to RouDi
+    /// @param[out] answer binary response from RouDi
+    /// @return true if communication was successful, false if not
+    bool sendRequestToRouDi(const IpcBinaryMessage& msg, IpcBinaryMessage& answer) noexcept;
+
+    /// @brief get the IPC message protocol version which was negotiated with RouDi during the registration
+    /// @return IpcBinaryMessage::TEXT_PROTOCOL_VERSION if only text messages are supported, otherwise the version of
+    ///         the binary protocol
+    uint8_t getIpcMessageProtocolVersion() const noexcept;
+
     /// @brief get the adress offset of the segment manager
     /// @return address offset as iox::RelativePointer::offset_t
     UntypedRelativePointer::offset_t getSegmentManagerAddressOffset() const noexcept;
@@ -84,6 +95,7 @@ class IpcRuntimeInterface
         uint64_t segmentId{0U};
         UntypedRelativePointer::offset_t segmentManagerAddressOffset{UntypedRelativePointer::NULL_POINTER_OFFSET};
         optional<UntypedRelativePointer::offset_t> heartbeatAddressOffset;
+        uint8_t ipcMessageProtocolVersion{IpcBinaryMessage::TEXT_PROTOCOL_VERSION};
     };
 
     enum class RegAckResult
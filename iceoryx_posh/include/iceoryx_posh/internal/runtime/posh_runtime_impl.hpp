@@ -100,19 +100,38 @@ class PoshRuntimeImpl : public PoshRuntime
 
   private:
     expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    requestPublisherFromRoudi(const capro::ServiceDescription& service,
+                              const popo::PublisherOptions& options,
+                              const PortConfigInfo& portConfigInfo) noexcept;
 
     expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    requestSubscriberFromRoudi(const capro::ServiceDescription& service,
+                               const popo::SubscriberOptions& options,
+                               const PortConfigInfo& portConfigInfo) noexcept;
 
     expected<popo::ClientPortUser::MemberType_t*, IpcMessageErrorType>
-    requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    requestClientFromRoudi(const capro::ServiceDescription& service,
+                           const popo::ClientOptions& options,
+                           const PortConfigInfo& portConfigInfo) noexcept;
 
     expected<popo::ServerPortUser::MemberType_t*, IpcMessageErrorType>
-    requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    requestServerFromRoudi(const capro::ServiceDescription& service,
+                           const popo::ServerOptions& options,
+                           const PortConfigInfo& portConfigInfo) noexcept;
 
     expected<popo::ConditionVariableData*, IpcMessageErrorType>
-    requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    requestConditionVariableFromRoudi() noexcept;
+
+    /// @brief sends a port request as binary message and converts the acknowledgement to a pointer to the port data
+    template <typename PortDataType>
+    expected<PortDataType*, IpcMessageErrorType>
+    requestPortFromRoudi(const IpcBinaryMessage& sendBuffer,
+                         const IpcMessageType acknowledgement,
+                         const IpcMessageErrorType invalidResponseError,
+                         const IpcMessageErrorType wrongResponseError) noexcept;
+
+    /// @brief returns true if the binary IPC message protocol was negotiated with RouDi
+    bool usesBinaryIpcMessages() noexcept;
 
     expected<std::tuple<segment_id_underlying_t, UntypedRelativePointer::offset_t>, IpcMessageErrorType>
     convert_id_and_offset(IpcMessage& msg);
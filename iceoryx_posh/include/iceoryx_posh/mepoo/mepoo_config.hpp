@@ -29,23 +29,62 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines how the MemoryManager searches the mempool with the best fitting chunk size
+enum class SizeClassLookup : uint8_t
+{
+    /// @brief walks through the mempools until a fitting one is found
+    LINEAR_SEARCH,
+    /// @brief branch-free binary search over the sorted chunk sizes of the mempools
+    BINARY_SEARCH
+};
+
+/// @brief Defines what the MemoryManager does when the best fitting mempool is out of chunks
+enum class MemPoolOverflowPolicy : uint8_t
+{
+    /// @brief the chunk request fails
+    FAIL,
+    /// @brief the chunk is taken from the next larger mempool which has a free chunk
+    USE_LARGER_MEMPOOL
+};
+
+/// @brief Defines how the shared memory of a segment is acquired from the system
+struct SegmentMemoryOptions
+{
+    /// @brief populate the page tables when the segment is mapped instead of faulting in every page on first access
+    bool m_prefault{false};
+    /// @brief number of threads which set the segment to zero on creation
+    uint32_t m_zeroingThreads{1U};
+    /// @brief advise the system to back the segment with transparent huge pages
+    bool m_transparentHugePages{false};
+    /// @brief lock the segment into RAM
+    bool m_lockMemory{false};
+};
+
 struct MePooConfig
 {
   public:
     struct Entry
     {
         /// @brief set the size and count of memory chunks
-        Entry(uint64_t size, uint32_t chunkCount) noexcept
+        /// @param[in] size of the chunk-payload
+        /// @param[in] chunkCount is the number of chunks
+        /// @param[in] chunkCacheDepth is the number of free chunks every thread can cache, 0 disables the cache
+        Entry(uint64_t size, uint32_t chunkCount, uint32_t chunkCacheDepth = 0U) noexcept
             : m_size(size)
             , m_chunkCount(chunkCount)
+            , m_chunkCacheDepth(chunkCacheDepth)
         {
         }
         uint64_t m_size{0};
         uint32_t m_chunkCount{0};
+        uint32_t m_chunkCacheDepth{0};
     };
 
     using MePooConfigContainerType = vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    SizeClassLookup m_sizeClassLookup{SizeClassLookup::BINARY_SEARCH};
+    MemPoolOverflowPolicy m_overflowPolicy{MemPoolOverflowPolicy::FAIL};
+    SegmentMemoryOptions m_segmentMemoryOptions;
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
@@ -41,6 +41,15 @@ enum class QueueFullPolicy : uint8_t
     DISCARD_OLDEST_DATA
 };
 
+/// @brief Used by producers to select how the chunks are delivered to the consumer queues
+enum class QueueDeliveryMode : uint8_t
+{
+    /// The list of consumer queues is protected by the producer lock for the whole delivery
+    LOCKED,
+    /// The producer iterates over an epoch protected snapshot of the consumer queues without taking the lock
+    LOCK_FREE_SNAPSHOT
+};
+
 } // namespace popo
 } // namespace iox
 #endif // IOX_POSH_POPO_PORT_QUEUE_POLICIES_HPP
@@ -45,6 +45,10 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The option how the chunks are delivered to the subscriber queues; with
+    /// QueueDeliveryMode::LOCK_FREE_SNAPSHOT and a historyCapacity of 0 the publisher does not take a lock to deliver
+    QueueDeliveryMode deliveryMode{QueueDeliveryMode::LOCKED};
+
     /// @brief serialization of the PublisherOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
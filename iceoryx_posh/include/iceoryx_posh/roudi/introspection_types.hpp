@@ -41,6 +41,14 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
     uint64_t m_chunkPayloadSize{0};
+    /// @brief the maximum number of used chunks since the previous introspection sample
+    uint32_t m_maxUsedChunksInInterval{0};
+    /// @brief the number of allocations which failed since the mempool had no free chunk left
+    uint64_t m_allocationFailures{0};
+    /// @brief bucket i counts the allocations which requested between i/N and (i+1)/N of the chunk size, i.e. the
+    /// lower buckets show the internal fragmentation of the mempool
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) plain data which is sent via shared memory
+    uint64_t m_chunkFillHistogram[NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS]{};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -99,6 +107,10 @@ struct PortThroughputData
     double m_chunksPerMinute{0};
     uint64_t m_lastSendIntervalInNanoseconds{0};
     bool m_isField{false};
+    /// @brief histogram of the time the publisher was blocked by full subscriber queues; bucket 0 counts the blockings
+    /// below 1us, bucket i the ones in the range [2^(i-1)us, 2^i us[ and the last one additionally all longer ones
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) plain data which is sent via shared memory
+    uint64_t m_blockedDeliveryLatencyHistogram[NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS]{};
 };
 
 /// @brief the topic for the port throughput that a user can subscribe to
@@ -68,6 +68,9 @@ class PortPool
     PortPoolData::InterfaceContainer& getInterfacePortDataList() noexcept;
     PortPoolData::CondVarContainer& getConditionVariableDataList() noexcept;
 
+    /// @brief Returns the data the ports use to request a run of the discovery loop
+    popo::DiscoveryNotificationData& getDiscoveryNotificationData() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -160,6 +163,8 @@ class PortPool
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
   private:
+    void connectToDiscovery(popo::BasePortData& portData) noexcept;
+
     PortPoolData* m_portPoolData;
 };
 
@@ -32,9 +32,9 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
         serviceDescription,
         runtimeName,
         uniqueRouDiId,
-        (subscriberOptions.queueFullPolicy == popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
-            ? popo::VariantQueueTypes::SoFi_MultiProducerSingleConsumer
-            : popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+        popo::multiProducerQueueType(subscriberOptions.queueFullPolicy,
+                                     subscriberOptions.queueCapacity,
+                                     popo::SubscriberPortData::ChunkQueueData_t::MAX_CAPACITY),
         subscriberOptions,
         memoryInfo);
     if (port == getSubscriberPortDataList().end())
@@ -46,6 +46,10 @@ struct RouDiConfig
     /// @brief Sets the delay in seconds before RouDi sends SIGKILL to application which did not respond to the initial
     /// SIGTERM signal
     units::Duration processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    /// @brief The number of threads which process the requests of the runtimes, e.g. the registration or the creation
+    /// of ports; the requests of different runtimes are processed concurrently when more than one thread is used.
+    /// Must be in the range of [1, roudi::MAX_RUNTIME_MESSAGES_THREADS]
+    uint32_t runtimeMessagesThreadCount{1U};
 
     // have some spare chunks to still deliver introspection data in case there are multiple subscribers to the data
     // which are caching different samples; could probably be reduced to 2 with the instruction to not cache the
@@ -83,7 +83,14 @@ class ServiceDiscovery
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         {1U, 1U, iox::NodeName_t("Service Registry"), true}};
 
+    // the registry is kept up to date by applying the deltas; the snapshots are only taken to catch up when deltas
+    // were missed
+    popo::Subscriber<roudi::ServiceRegistry::Delta> m_serviceRegistryDeltaSubscriber{
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME},
+        {SERVICE_REGISTRY_DELTA_HISTORY, SERVICE_REGISTRY_DELTA_HISTORY, iox::NodeName_t("Service Registry"), true}};
+
     void update();
+    void takeNewerSnapshot();
 };
 
 } // namespace runtime
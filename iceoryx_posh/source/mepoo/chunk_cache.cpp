@@ -0,0 +1,102 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
+#include "iox/assertions.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr ChunkCache::Owner_t ChunkCache::NO_OWNER;
+
+void ChunkCache::init(not_null<uint32_t*> indices, const uint32_t capacity) noexcept
+{
+    m_indices = indices;
+    m_capacity = capacity;
+    m_size.store(0U, std::memory_order_relaxed);
+    m_owner.store(NO_OWNER, std::memory_order_release);
+}
+
+ChunkCache::Owner_t ChunkCache::createOwner(const uint32_t pid, const uint32_t threadId) noexcept
+{
+    IOX_ENFORCE(threadId != 0U, "The thread id must not be 0");
+    constexpr uint64_t PID_SHIFT{32U};
+    return (static_cast<Owner_t>(pid) << PID_SHIFT) | static_cast<Owner_t>(threadId);
+}
+
+uint32_t ChunkCache::pidOf(const Owner_t owner) noexcept
+{
+    constexpr uint64_t PID_SHIFT{32U};
+    return static_cast<uint32_t>(owner >> PID_SHIFT);
+}
+
+bool ChunkCache::tryClaim(const Owner_t owner) noexcept
+{
+    auto expected = NO_OWNER;
+    return m_owner.compare_exchange_strong(expected, owner, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+void ChunkCache::release() noexcept
+{
+    IOX_ENFORCE(m_size.load(std::memory_order_relaxed) == 0U, "Only an empty chunk cache can be released");
+    m_owner.store(NO_OWNER, std::memory_order_release);
+}
+
+ChunkCache::Owner_t ChunkCache::getOwner() const noexcept
+{
+    return m_owner.load(std::memory_order_acquire);
+}
+
+bool ChunkCache::push(const uint32_t index) noexcept
+{
+    const auto size = m_size.load(std::memory_order_relaxed);
+    if (size >= m_capacity)
+    {
+        return false;
+    }
+    // the index is written before the size is increased in order to never expose an index which is not yet stored
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the indices are stored in the management memory
+    m_indices.get()[size] = index;
+    m_size.store(size + 1U, std::memory_order_release);
+    return true;
+}
+
+bool ChunkCache::pop(uint32_t& index) noexcept
+{
+    const auto size = m_size.load(std::memory_order_relaxed);
+    if (size == 0U)
+    {
+        return false;
+    }
+    m_size.store(size - 1U, std::memory_order_relaxed);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the indices are stored in the management memory
+    index = m_indices.get()[size - 1U];
+    return true;
+}
+
+uint32_t ChunkCache::size() const noexcept
+{
+    return m_size.load(std::memory_order_acquire);
+}
+
+uint32_t ChunkCache::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+} // namespace mepoo
+} // namespace iox
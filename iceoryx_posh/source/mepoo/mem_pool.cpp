@@ -18,8 +18,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_platform/unistd.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/assertions.hpp"
+#include "iox/vector.hpp"
 
 #include <algorithm>
 
@@ -40,14 +42,142 @@ MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
 
 constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
 
+/// @brief The chunk caches of the current thread. The MemPool to ChunkCache mapping is only valid as long as no
+/// MemPool was destroyed in the process since a new MemPool could be created at the same address. When the mapping is
+/// lost, the thread finds its caches again by their owner.
+class MemPool::ThreadLocalChunkCaches
+{
+  public:
+    ThreadLocalChunkCaches() noexcept;
+    ~ThreadLocalChunkCaches() noexcept;
+
+    ThreadLocalChunkCaches(const ThreadLocalChunkCaches&) = delete;
+    ThreadLocalChunkCaches(ThreadLocalChunkCaches&&) = delete;
+    ThreadLocalChunkCaches& operator=(const ThreadLocalChunkCaches&) = delete;
+    ThreadLocalChunkCaches& operator=(ThreadLocalChunkCaches&&) = delete;
+
+    /// @brief Returns the chunk cache of the current thread for a MemPool
+    /// @param[in] memPool for which the cache is requested
+    /// @return the chunk cache or nullptr if all caches of the MemPool are used or the thread is already terminating
+    static ChunkCache* get(MemPool& memPool) noexcept;
+
+    /// @brief Invalidates the MemPool to ChunkCache mapping of all threads
+    static void invalidate() noexcept;
+
+  private:
+    struct Entry
+    {
+        MemPool* memPool{nullptr};
+        ChunkCache* chunkCache{nullptr};
+    };
+
+    ChunkCache* lookup(MemPool& memPool) noexcept;
+
+    static constexpr uint32_t MAX_NUMBER_OF_ENTRIES{32U};
+    static concurrent::Atomic<uint32_t> s_nextThreadId;
+    static concurrent::Atomic<uint64_t> s_generation;
+    // the destructor of the thread local object is called before e.g. a static publisher releases its chunks when the
+    // process terminates, therefore a trivially destructible flag is required to not access the destroyed object
+    static thread_local bool s_isDestroyed;
+
+    ChunkCache::Owner_t m_owner{ChunkCache::NO_OWNER};
+    uint64_t m_generation{0U};
+    vector<Entry, MAX_NUMBER_OF_ENTRIES> m_entries;
+};
+
+constexpr uint32_t MemPool::ThreadLocalChunkCaches::MAX_NUMBER_OF_ENTRIES;
+concurrent::Atomic<uint32_t> MemPool::ThreadLocalChunkCaches::s_nextThreadId{1U};
+concurrent::Atomic<uint64_t> MemPool::ThreadLocalChunkCaches::s_generation{0U};
+thread_local bool MemPool::ThreadLocalChunkCaches::s_isDestroyed{false};
+
+MemPool::ThreadLocalChunkCaches::ThreadLocalChunkCaches() noexcept
+    : m_owner(ChunkCache::createOwner(static_cast<uint32_t>(getpid()),
+                                      s_nextThreadId.fetch_add(1U, std::memory_order_relaxed)))
+    , m_generation(s_generation.load(std::memory_order_acquire))
+{
+}
+
+MemPool::ThreadLocalChunkCaches::~ThreadLocalChunkCaches() noexcept
+{
+    s_isDestroyed = true;
+    // when a MemPool was destroyed in the meantime, the MemPools of the entries might not exist anymore; the caches of
+    // the remaining MemPools are then reclaimed by RouDi
+    if (m_generation != s_generation.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    for (auto& entry : m_entries)
+    {
+        if (entry.chunkCache != nullptr)
+        {
+            entry.memPool->releaseChunkCache(*entry.chunkCache);
+        }
+    }
+}
+
+ChunkCache* MemPool::ThreadLocalChunkCaches::get(MemPool& memPool) noexcept
+{
+    if (s_isDestroyed)
+    {
+        return nullptr;
+    }
+    thread_local ThreadLocalChunkCaches chunkCaches;
+    return chunkCaches.lookup(memPool);
+}
+
+void MemPool::ThreadLocalChunkCaches::invalidate() noexcept
+{
+    s_generation.fetch_add(1U, std::memory_order_acq_rel);
+}
+
+ChunkCache* MemPool::ThreadLocalChunkCaches::lookup(MemPool& memPool) noexcept
+{
+    const auto generation = s_generation.load(std::memory_order_acquire);
+    if (m_generation != generation)
+    {
+        m_entries.clear();
+        m_generation = generation;
+    }
+
+    for (const auto& entry : m_entries)
+    {
+        if (entry.memPool == &memPool)
+        {
+            return entry.chunkCache;
+        }
+    }
+
+    // the entry is also created when no cache is available in order to not search for a free cache on every call
+    auto* chunkCache = memPool.acquireChunkCache(m_owner);
+    if (m_entries.size() == MAX_NUMBER_OF_ENTRIES)
+    {
+        auto& evictedEntry = m_entries.front();
+        if (evictedEntry.chunkCache != nullptr)
+        {
+            evictedEntry.memPool->releaseChunkCache(*evictedEntry.chunkCache);
+        }
+        m_entries.erase(m_entries.begin());
+    }
+    m_entries.emplace_back(Entry{&memPool, chunkCache});
+
+    return chunkCache;
+}
+
 MemPool::MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
                  const greater_or_equal<uint32_t, 1> numberOfChunks,
                  iox::BumpAllocator& managementAllocator,
-                 iox::BumpAllocator& chunkMemoryAllocator) noexcept
+                 iox::BumpAllocator& chunkMemoryAllocator,
+                 const uint32_t chunkCacheDepth) noexcept
     : m_chunkSize(chunkSize)
     , m_numberOfChunks(numberOfChunks)
     , m_minFree(numberOfChunks)
+    , m_chunkCacheDepth(std::min(chunkCacheDepth, MAX_CHUNK_CACHE_DEPTH))
 {
+    for (auto& bucket : m_chunkFillHistogram)
+    {
+        bucket.store(0U, std::memory_order_relaxed);
+    }
+
     if (isMultipleOfAlignment(chunkSize))
     {
         IOX_ENFORCE(m_chunkSize <= std::numeric_limits<uint64_t>::max() / m_numberOfChunks,
@@ -61,6 +191,24 @@ MemPool::MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkS
             managementAllocator.allocate(freeList_t::requiredIndexMemorySize(m_numberOfChunks), CHUNK_MEMORY_ALIGNMENT)
                 .expect("Allocating free list memory for 'MemPool'");
         m_freeIndices.init(static_cast<freeList_t::Index_t*>(memoryFreeList), m_numberOfChunks);
+
+        if (m_chunkCacheDepth > 0U)
+        {
+            auto* memoryChunkCaches =
+                managementAllocator.allocate(requiredChunkCacheMemorySize(m_chunkCacheDepth), CHUNK_MEMORY_ALIGNMENT)
+                    .expect("Allocating chunk cache memory for 'MemPool'");
+            auto* chunkCaches = static_cast<ChunkCache*>(memoryChunkCaches);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the indices follow the caches
+            auto* indices = reinterpret_cast<uint32_t*>(chunkCaches + MAX_NUMBER_OF_CHUNK_CACHES_PER_MEMPOOL);
+            for (uint32_t i = 0U; i < MAX_NUMBER_OF_CHUNK_CACHES_PER_MEMPOOL; ++i)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) array in the management memory
+                auto* chunkCache = new (chunkCaches + i) ChunkCache();
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) array in the management memory
+                chunkCache->init(indices + static_cast<uint64_t>(i) * m_chunkCacheDepth, m_chunkCacheDepth);
+            }
+            m_chunkCaches = chunkCaches;
+        }
     }
     else
     {
@@ -71,33 +219,62 @@ MemPool::MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkS
     }
 }
 
+MemPool::~MemPool() noexcept
+{
+    ThreadLocalChunkCaches::invalidate();
+}
+
+uint64_t MemPool::requiredChunkCacheMemorySize(const uint32_t chunkCacheDepth) noexcept
+{
+    const auto depth = std::min(chunkCacheDepth, MAX_CHUNK_CACHE_DEPTH);
+    if (depth == 0U)
+    {
+        return 0U;
+    }
+    return MAX_NUMBER_OF_CHUNK_CACHES_PER_MEMPOOL
+           * (sizeof(ChunkCache) + static_cast<uint64_t>(depth) * sizeof(uint32_t));
+}
+
 bool MemPool::isMultipleOfAlignment(const uint64_t value) const noexcept
 {
     return (value % CHUNK_MEMORY_ALIGNMENT == 0U);
 }
 
-void MemPool::adjustMinFree() noexcept
+void MemPool::adjustMinFreeAndMaxUsed(const uint32_t usedChunks) noexcept
 {
-    // @todo iox-#1714 rethink the concurrent change that can happen. do we need a CAS loop?
-    m_minFree.store(std::min(m_numberOfChunks - m_usedChunks.load(std::memory_order_relaxed),
-                             m_minFree.load(std::memory_order_relaxed)));
+    // the value is derived from the increment of this getChunk call and not reloaded from m_usedChunks, therefore a
+    // concurrent getChunk or freeChunk cannot hide the peak; the CAS loops ensure that only smaller or larger values
+    // are stored
+    const uint32_t freeChunks = m_numberOfChunks - usedChunks;
+    auto minFree = m_minFree.load(std::memory_order_relaxed);
+    while (freeChunks < minFree
+           && !m_minFree.compare_exchange_weak(
+               minFree, freeChunks, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+
+    auto maxUsed = m_maxUsedInInterval.load(std::memory_order_relaxed);
+    while (usedChunks > maxUsed
+           && !m_maxUsedInInterval.compare_exchange_weak(
+               maxUsed, usedChunks, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
 }
 
 void* MemPool::getChunk() noexcept
 {
     uint32_t index{0U};
-    if (!m_freeIndices.pop(index))
+    if (!popFreeIndex(index))
     {
+        m_allocationFailures.fetch_add(1U, std::memory_order_relaxed);
         IOX_LOG(Warn,
                 "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
                                           << ", used_chunks = " << m_usedChunks.load() << " ] has no more space left");
         return nullptr;
     }
 
-    /// @todo iox-#1714 verify that m_usedChunk is not changed during adjustMInFree
-    ///         without changing m_minFree
-    m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
-    adjustMinFree();
+    const auto usedChunks = m_usedChunks.fetch_add(1U, std::memory_order_relaxed) + 1U;
+    adjustMinFreeAndMaxUsed(usedChunks);
 
     return indexToPointer(index, m_chunkSize, m_rawMemory.get());
 }
@@ -149,12 +326,123 @@ void MemPool::freeChunk(const void* chunk) noexcept
 
     const auto index = pointerToIndex(chunk, m_chunkSize, memPoolStartAddress);
 
+    pushFreeIndex(index);
+
+    m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+bool MemPool::popFreeIndex(uint32_t& index) noexcept
+{
+    auto* chunkCache = (m_chunkCacheDepth > 0U) ? ThreadLocalChunkCaches::get(*this) : nullptr;
+    if (chunkCache == nullptr)
+    {
+        return m_freeIndices.pop(index);
+    }
+
+    if (chunkCache->pop(index))
+    {
+        return true;
+    }
+
+    if (!m_freeIndices.pop(index))
+    {
+        return false;
+    }
+
+    // refill half of the cache to amortize the access to the free list over the following calls
+    const uint32_t numberOfChunksToRefill{std::max(m_chunkCacheDepth / 2U, 1U) - 1U};
+    uint32_t refillIndex{0U};
+    for (uint32_t i = 0U; i < numberOfChunksToRefill && m_freeIndices.pop(refillIndex); ++i)
+    {
+        IOX_ENFORCE(chunkCache->push(refillIndex), "An empty chunk cache must be able to hold half of its depth");
+    }
+
+    return true;
+}
+
+void MemPool::pushFreeIndex(const uint32_t index) noexcept
+{
+    auto* chunkCache = (m_chunkCacheDepth > 0U) ? ThreadLocalChunkCaches::get(*this) : nullptr;
+    if (chunkCache == nullptr)
+    {
+        pushToFreeList(index);
+        return;
+    }
+
+    if (!chunkCache->push(index))
+    {
+        // flush half of the cache to amortize the access to the free list over the following calls
+        const uint32_t numberOfChunksToFlush{std::max(m_chunkCacheDepth / 2U, 1U)};
+        uint32_t flushIndex{0U};
+        for (uint32_t i = 0U; i < numberOfChunksToFlush && chunkCache->pop(flushIndex); ++i)
+        {
+            pushToFreeList(flushIndex);
+        }
+        IOX_ENFORCE(chunkCache->push(index), "A flushed chunk cache must have space for a chunk");
+    }
+}
+
+void MemPool::pushToFreeList(const uint32_t index) noexcept
+{
     if (!m_freeIndices.push(index))
     {
         IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
     }
+}
 
-    m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
+ChunkCache* MemPool::acquireChunkCache(const ChunkCache::Owner_t owner) noexcept
+{
+    auto* chunkCaches = m_chunkCaches.get();
+    // a thread which lost the mapping to its cache still owns the cache
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_CHUNK_CACHES_PER_MEMPOOL; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) array in the management memory
+        if (chunkCaches[i].getOwner() == owner)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) array in the management memory
+            return &chunkCaches[i];
+        }
+    }
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_CHUNK_CACHES_PER_MEMPOOL; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) array in the management memory
+        if (chunkCaches[i].tryClaim(owner))
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) array in the management memory
+            return &chunkCaches[i];
+        }
+    }
+    return nullptr;
+}
+
+void MemPool::releaseChunkCache(ChunkCache& chunkCache) noexcept
+{
+    uint32_t index{0U};
+    while (chunkCache.pop(index))
+    {
+        pushToFreeList(index);
+    }
+    chunkCache.release();
+}
+
+void MemPool::reclaimChunkCaches(const uint32_t pid) noexcept
+{
+    if (m_chunkCacheDepth == 0U)
+    {
+        return;
+    }
+
+    auto* chunkCaches = m_chunkCaches.get();
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_CHUNK_CACHES_PER_MEMPOOL; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) array in the management memory
+        auto& chunkCache = chunkCaches[i];
+        const auto owner = chunkCache.getOwner();
+        if (owner != ChunkCache::NO_OWNER && ChunkCache::pidOf(owner) == pid)
+        {
+            releaseChunkCache(chunkCache);
+        }
+    }
 }
 
 uint64_t MemPool::getChunkSize() const noexcept
@@ -177,12 +465,55 @@ uint32_t MemPool::getMinFree() const noexcept
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+uint32_t MemPool::getChunkCacheDepth() const noexcept
+{
+    return m_chunkCacheDepth;
+}
+
+uint32_t MemPool::getMaxUsedChunksInInterval() const noexcept
+{
+    return m_maxUsedInInterval.load(std::memory_order_relaxed);
+}
+
+uint64_t MemPool::getAllocationFailures() const noexcept
+{
+    return m_allocationFailures.load(std::memory_order_relaxed);
+}
+
 MemPoolInfo MemPool::getInfo() const noexcept
 {
-    return {m_usedChunks.load(std::memory_order_relaxed),
-            m_minFree.load(std::memory_order_relaxed),
-            m_numberOfChunks,
-            m_chunkSize};
+    MemPoolInfo info{m_usedChunks.load(std::memory_order_relaxed),
+                     m_minFree.load(std::memory_order_relaxed),
+                     m_numberOfChunks,
+                     m_chunkSize};
+    info.m_maxUsedChunksInInterval = m_maxUsedInInterval.load(std::memory_order_relaxed);
+    info.m_allocationFailures = m_allocationFailures.load(std::memory_order_relaxed);
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) i is limited by the array size
+        info.m_chunkFillHistogram[i] = m_chunkFillHistogram[i].load(std::memory_order_relaxed);
+    }
+    return info;
+}
+
+MemPoolInfo MemPool::collectInfo() noexcept
+{
+    auto info = getInfo();
+    // the new interval starts with the chunks which are currently in use; a getChunk call between the load of
+    // m_usedChunks and the exchange is attributed to both intervals, which is fine for a high-water mark
+    const auto usedChunks = m_usedChunks.load(std::memory_order_relaxed);
+    info.m_maxUsedChunksInInterval =
+        std::max(m_maxUsedInInterval.exchange(usedChunks, std::memory_order_relaxed), info.m_usedChunks);
+    return info;
+}
+
+void MemPool::recordChunkFill(const uint64_t requiredChunkSize) noexcept
+{
+    const uint64_t bucket =
+        std::min(requiredChunkSize * NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS / m_chunkSize,
+                 static_cast<uint64_t>(NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS - 1U));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) bucket is limited by the array size
+    m_chunkFillHistogram[bucket].fetch_add(1U, std::memory_order_relaxed);
 }
 
 } // namespace mepoo
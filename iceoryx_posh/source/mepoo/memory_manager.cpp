@@ -22,6 +22,7 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/logging.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace iox
@@ -41,7 +42,8 @@ void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
                                BumpAllocator& chunkMemoryAllocator,
                                const greater_or_equal<uint64_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                               const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept
+                               const greater_or_equal<uint32_t, 1> numberOfChunks,
+                               const uint32_t chunkCacheDepth) noexcept
 {
     uint64_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint64_t>(chunkPayloadSize));
     if (m_denyAddMemPool)
@@ -63,15 +65,21 @@ void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
         IOX_REPORT_FATAL(iox::PoshError::MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE);
     }
 
-    m_memPoolVector.emplace_back(adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator);
+    m_memPoolVector.emplace_back(
+        adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator, chunkCacheDepth);
+    m_chunkSizes.emplace_back(adjustedChunkSize);
     m_totalNumberOfChunks += numberOfChunks;
+    m_maxChunkCacheDepth = std::max(m_maxChunkCacheDepth, chunkCacheDepth);
 }
 
 void MemoryManager::generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept
 {
     m_denyAddMemPool = true;
     uint64_t chunkSize = sizeof(ChunkManagement);
-    m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
+    // every chunk requires a ChunkManagement, therefore the chunk management pool is cached as deep as the deepest
+    // cached mempool
+    m_chunkManagementPool.emplace_back(
+        chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator, m_maxChunkCacheDepth);
 }
 
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
@@ -88,6 +96,27 @@ MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
     return m_memPoolVector[index].getInfo();
 }
 
+MemPoolInfo MemoryManager::collectMemPoolInfo(const uint32_t index) noexcept
+{
+    if (index >= m_memPoolVector.size())
+    {
+        return {0, 0, 0, 0};
+    }
+    return m_memPoolVector[index].collectInfo();
+}
+
+void MemoryManager::reclaimChunkCaches(const uint32_t pid) noexcept
+{
+    for (auto& memPool : m_memPoolVector)
+    {
+        memPool.reclaimChunkCaches(pid);
+    }
+    for (auto& chunkManagementPool : m_chunkManagementPool)
+    {
+        chunkManagementPool.reclaimChunkCaches(pid);
+    }
+}
+
 uint64_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept
 {
     return size + sizeof(ChunkHeader);
@@ -113,15 +142,20 @@ uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooCon
 {
     uint64_t memorySize{0U};
     uint64_t sumOfAllChunks{0U};
+    uint32_t maxChunkCacheDepth{0U};
     for (const auto& mempool : mePooConfig.m_mempoolConfig)
     {
         sumOfAllChunks += mempool.m_chunkCount;
+        maxChunkCacheDepth = std::max(maxChunkCacheDepth, mempool.m_chunkCacheDepth);
         memorySize +=
             align(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_chunkCount), MemPool::CHUNK_MEMORY_ALIGNMENT);
+        memorySize +=
+            align(MemPool::requiredChunkCacheMemorySize(mempool.m_chunkCacheDepth), MemPool::CHUNK_MEMORY_ALIGNMENT);
     }
 
     memorySize += align(sumOfAllChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
     memorySize += align(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    memorySize += align(MemPool::requiredChunkCacheMemorySize(maxChunkCacheDepth), MemPool::CHUNK_MEMORY_ALIGNMENT);
 
     return memorySize;
 }
@@ -135,34 +169,60 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
                                            BumpAllocator& managementAllocator,
                                            BumpAllocator& chunkMemoryAllocator) noexcept
 {
+    m_sizeClassLookup = mePooConfig.m_sizeClassLookup;
+    m_overflowPolicy = mePooConfig.m_overflowPolicy;
+
     for (auto entry : mePooConfig.m_mempoolConfig)
     {
-        addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
+        addMemPool(
+            managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount, entry.m_chunkCacheDepth);
     }
 
     generateChunkManagementPool(managementAllocator);
 }
 
-expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+uint32_t MemoryManager::findMemPoolIndex(const uint64_t requiredChunkSize) const noexcept
 {
-    void* chunk{nullptr};
-    MemPool* memPoolPointer{nullptr};
-    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+    const auto numberOfMemPools = static_cast<uint32_t>(m_chunkSizes.size());
+    const auto* chunkSizes = m_chunkSizes.data();
 
-    uint64_t aquiredChunkSize = 0U;
-
-    for (auto& memPool : m_memPoolVector)
+    if (m_sizeClassLookup == SizeClassLookup::LINEAR_SEARCH)
     {
-        uint64_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        for (uint32_t i = 0U; i < numberOfMemPools; ++i)
         {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is less than the size
+            if (chunkSizes[i] >= requiredChunkSize)
+            {
+                return i;
+            }
         }
+        return numberOfMemPools;
     }
 
+    if (numberOfMemPools == 0U)
+    {
+        return 0U;
+    }
+
+    // lower bound with a fixed number of iterations; the conditional is compiled to a conditional move and therefore
+    // the lookup does not suffer from branch mispredictions
+    uint32_t base{0U};
+    uint32_t length{numberOfMemPools};
+    while (length > 1U)
+    {
+        const uint32_t half{length / 2U};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) base + half is less than the size
+        base = (chunkSizes[base + half] < requiredChunkSize) ? base + half : base;
+        length -= half;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) base is less than the size
+    return base + ((chunkSizes[base] < requiredChunkSize) ? 1U : 0U);
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+
     if (m_memPoolVector.size() == 0)
     {
         IOX_LOG(Error, "There are no mempools available!");
@@ -170,7 +230,10 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
         IOX_REPORT(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL, iox::er::RUNTIME_ERROR);
         return err(Error::NO_MEMPOOLS_AVAILABLE);
     }
-    else if (memPoolPointer == nullptr)
+
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    auto memPoolIndex = findMemPoolIndex(requiredChunkSize);
+    if (memPoolIndex >= numberOfMemPools)
     {
         IOX_LOG(
             Error,
@@ -183,7 +246,18 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
         IOX_REPORT(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE, iox::er::RUNTIME_ERROR);
         return err(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE);
     }
-    else if (chunk == nullptr)
+
+    void* chunk = m_memPoolVector[memPoolIndex].getChunk();
+    if (m_overflowPolicy == MemPoolOverflowPolicy::USE_LARGER_MEMPOOL)
+    {
+        while (chunk == nullptr && memPoolIndex + 1U < numberOfMemPools)
+        {
+            ++memPoolIndex;
+            chunk = m_memPoolVector[memPoolIndex].getChunk();
+        }
+    }
+
+    if (chunk == nullptr)
     {
         IOX_LOG(
             Error,
@@ -197,13 +271,13 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
         IOX_REPORT(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, iox::er::RUNTIME_ERROR);
         return err(Error::MEMPOOL_OUT_OF_CHUNKS);
     }
-    else
-    {
-        auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
-        return ok(SharedChunk(chunkManagement));
-    }
+
+    auto& memPool = m_memPoolVector[memPoolIndex];
+    memPool.recordChunkFill(requiredChunkSize);
+    auto chunkHeader = new (chunk) ChunkHeader(memPool.getChunkSize(), chunkSettings);
+    auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
+        ChunkManagement(chunkHeader, &memPool, &m_chunkManagementPool.front());
+    return ok(SharedChunk(chunkManagement));
 }
 
 std::ostream& operator<<(std::ostream& stream, const MemoryManager::Error value) noexcept
@@ -19,6 +19,8 @@
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/logging.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace mepoo
@@ -74,10 +76,12 @@ MePooConfig& MePooConfig::optimize() noexcept
             }
             newEntry.m_size = entry.m_size;
             newEntry.m_chunkCount = entry.m_chunkCount;
+            newEntry.m_chunkCacheDepth = entry.m_chunkCacheDepth;
         }
         else
         {
             newEntry.m_chunkCount += entry.m_chunkCount;
+            newEntry.m_chunkCacheDepth = std::max(newEntry.m_chunkCacheDepth, entry.m_chunkCacheDepth);
         }
     }
 
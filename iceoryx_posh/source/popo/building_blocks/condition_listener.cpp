@@ -43,6 +43,24 @@ void ConditionListener::resetSemaphore() noexcept
     }
 }
 
+bool ConditionListener::spinOnSemaphore() noexcept
+{
+    for (uint32_t i = 0U; i < CONDITION_LISTENER_SPIN_ITERATIONS; ++i)
+    {
+        auto result = getMembers()->m_semaphore->tryWait();
+        // an error is reported by the subsequent blocking wait
+        if (result.has_error())
+        {
+            return false;
+        }
+        if (result.value())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void ConditionListener::destroy() volatile noexcept
 {
     m_toBeDestroyed.store(true, std::memory_order_relaxed);
@@ -58,6 +76,10 @@ bool ConditionListener::wasNotified() const noexcept
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
     return waitImpl([this]() -> bool {
+        if (this->spinOnSemaphore())
+        {
+            return true;
+        }
         if (this->getMembers()->m_semaphore->wait().has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT);
@@ -70,7 +92,7 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
     return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
+        if (!this->spinOnSemaphore() && this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT);
         }
@@ -81,18 +103,28 @@ ConditionListener::NotificationVector_t ConditionListener::timedWait(const units
 ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()> waitCall) noexcept
 {
     using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+    constexpr uint64_t NOTIFICATIONS_PER_WORD{ConditionVariableData::NOTIFICATIONS_PER_WORD};
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
+        for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
         {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
+            auto& word = getMembers()->m_activeNotifications[wordIndex];
+            // the load avoids acquiring the cache line for writing when no notification of this word is active
+            if (word.load(std::memory_order_relaxed) == 0U)
             {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
+                continue;
+            }
+
+            getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+            // the bits are iterated from the least significant one, therefore the vector stays sorted
+            for (auto bits = word.exchange(0U, std::memory_order_acquire); bits != 0U; bits &= bits - 1U)
+            {
+                activeNotifications.emplace_back(
+                    static_cast<Type_t>(wordIndex * NOTIFICATIONS_PER_WORD + countTrailingZeros(bits)));
             }
         }
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
@@ -106,12 +138,6 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const functi
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
-{
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
-}
-
 const ConditionVariableData* ConditionListener::getMembers() volatile const noexcept
 {
     return m_condVarDataPtr;
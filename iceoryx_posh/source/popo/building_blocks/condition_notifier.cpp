@@ -38,7 +38,7 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    getMembers()->setNotification(m_notificationIndex);
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
     getMembers()->m_semaphore->post().or_else(
         [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY); });
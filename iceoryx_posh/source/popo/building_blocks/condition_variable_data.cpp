@@ -36,10 +36,23 @@ ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) n
         .create(m_semaphore)
         .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE); });
 
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        word.store(0U, std::memory_order_relaxed);
     }
 }
+
+void ConditionVariableData::setNotification(const uint64_t index) noexcept
+{
+    m_activeNotifications[index / NOTIFICATIONS_PER_WORD].fetch_or(static_cast<uint64_t>(1U)
+                                                                        << (index % NOTIFICATIONS_PER_WORD),
+                                                                    std::memory_order_release);
+}
+
+bool ConditionVariableData::isNotificationActive(const uint64_t index) const noexcept
+{
+    const auto word = m_activeNotifications[index / NOTIFICATIONS_PER_WORD].load(std::memory_order_relaxed);
+    return (word & (static_cast<uint64_t>(1U) << (index % NOTIFICATIONS_PER_WORD))) != 0U;
+}
 } // namespace popo
 } // namespace iox
@@ -0,0 +1,73 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+namespace iox
+{
+namespace popo
+{
+LatencyHistogram::LatencyHistogram() noexcept
+{
+    reset();
+}
+
+void LatencyHistogram::record(const units::Duration& latency) noexcept
+{
+    m_buckets[bucketIndex(latency)].fetch_add(1U, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::count(const uint32_t bucketIndex) const noexcept
+{
+    if (bucketIndex >= NUMBER_OF_BUCKETS)
+    {
+        return 0U;
+    }
+    return m_buckets[bucketIndex].load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::totalCount() const noexcept
+{
+    uint64_t total{0U};
+    for (const auto& bucket : m_buckets)
+    {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void LatencyHistogram::reset() noexcept
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.store(0U, std::memory_order_relaxed);
+    }
+}
+
+uint32_t LatencyHistogram::bucketIndex(const units::Duration& latency) noexcept
+{
+    auto microseconds = latency.toMicroseconds();
+    uint32_t index{0U};
+    while (microseconds > 0U && index + 1U < NUMBER_OF_BUCKETS)
+    {
+        microseconds >>= 1U;
+        ++index;
+    }
+    return index;
+}
+
+} // namespace popo
+} // namespace iox
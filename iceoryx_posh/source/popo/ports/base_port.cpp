@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
 namespace iox
 {
@@ -64,6 +65,7 @@ BasePort::operator bool() const noexcept
 void BasePort::destroy() noexcept
 {
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    requestDiscovery();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -71,5 +73,25 @@ bool BasePort::toBeDestroyed() const noexcept
     return getMembers()->m_toBeDestroyed.load(std::memory_order_relaxed);
 }
 
+void BasePort::requestDiscovery() noexcept
+{
+    // the release ordering makes the preceding changes of the port visible to RouDi once it observes the request
+    getMembers()->m_discoveryRequested.store(true, std::memory_order_release);
+
+    auto* discoveryNotificationData = getMembers()->m_discoveryNotificationDataPtr.get();
+    if (discoveryNotificationData != nullptr)
+    {
+        discoveryNotificationData->m_portDiscoveryRequested.store(true, std::memory_order_release);
+        ConditionNotifier(discoveryNotificationData->m_conditionVariableData,
+                          DiscoveryNotificationData::PORT_NOTIFICATION_INDEX)
+            .notify();
+    }
+}
+
+bool BasePort::acquireDiscoveryRequest() noexcept
+{
+    return getMembers()->m_discoveryRequested.exchange(false, std::memory_order_acq_rel);
+}
+
 } // namespace popo
 } // namespace iox
@@ -21,10 +21,9 @@ namespace iox
 {
 namespace popo
 {
-VariantQueueTypes getResponseQueueType(const QueueFullPolicy policy) noexcept
+VariantQueueTypes getResponseQueueType(const QueueFullPolicy policy, const uint64_t capacity) noexcept
 {
-    return policy == QueueFullPolicy::DISCARD_OLDEST_DATA ? VariantQueueTypes::SoFi_MultiProducerSingleConsumer
-                                                          : VariantQueueTypes::FiFo_MultiProducerSingleConsumer;
+    return multiProducerQueueType(policy, capacity, ClientChunkReceiverData_t::ChunkQueueData_t::MAX_CAPACITY);
 }
 
 constexpr uint64_t ClientPortData::HISTORY_CAPACITY_ZERO;
@@ -37,9 +36,10 @@ ClientPortData::ClientPortData(const capro::ServiceDescription& serviceDescripti
                                const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, uniqueRouDiId)
     , m_chunkSenderData(memoryManager, clientOptions.serverTooSlowPolicy, HISTORY_CAPACITY_ZERO, memoryInfo)
-    , m_chunkReceiverData(getResponseQueueType(clientOptions.responseQueueFullPolicy),
-                          clientOptions.responseQueueFullPolicy,
-                          memoryInfo)
+    , m_chunkReceiverData(
+          getResponseQueueType(clientOptions.responseQueueFullPolicy, clientOptions.responseQueueCapacity),
+          clientOptions.responseQueueFullPolicy,
+          memoryInfo)
     , m_connectRequested(clientOptions.connectOnCreate)
 {
     m_chunkReceiverData.m_queue.setCapacity(clientOptions.responseQueueCapacity);
@@ -28,8 +28,11 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
                                      const PublisherOptions& publisherOptions,
                                      const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, uniqueRouDiId)
-    , m_chunkSenderData(
-          memoryManager, publisherOptions.subscriberTooSlowPolicy, publisherOptions.historyCapacity, memoryInfo)
+    , m_chunkSenderData(memoryManager,
+                        publisherOptions.subscriberTooSlowPolicy,
+                        publisherOptions.historyCapacity,
+                        memoryInfo,
+                        publisherOptions.deliveryMode)
     , m_options{publisherOptions}
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
@@ -71,6 +71,24 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunks(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.sendBatch(chunkHeaders);
+    }
+    else
+    {
+        // see sendChunk
+        for (auto* const chunkHeader : chunkHeaders)
+        {
+            m_chunkSender.pushToHistory(chunkHeader);
+        }
+    }
+}
+
 optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
@@ -81,6 +99,7 @@ void PublisherPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
@@ -89,6 +108,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
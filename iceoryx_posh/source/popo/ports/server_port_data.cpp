@@ -21,10 +21,9 @@ namespace iox
 {
 namespace popo
 {
-VariantQueueTypes getRequestQueueType(const QueueFullPolicy policy) noexcept
+VariantQueueTypes getRequestQueueType(const QueueFullPolicy policy, const uint64_t capacity) noexcept
 {
-    return policy == QueueFullPolicy::DISCARD_OLDEST_DATA ? VariantQueueTypes::SoFi_MultiProducerSingleConsumer
-                                                          : VariantQueueTypes::FiFo_MultiProducerSingleConsumer;
+    return multiProducerQueueType(policy, capacity, ServerChunkReceiverData_t::ChunkQueueData_t::MAX_CAPACITY);
 }
 
 constexpr uint64_t ServerPortData::HISTORY_REQUEST_OF_ZERO;
@@ -37,8 +36,9 @@ ServerPortData::ServerPortData(const capro::ServiceDescription& serviceDescripti
                                const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, uniqueRouDiId)
     , m_chunkSenderData(memoryManager, serverOptions.clientTooSlowPolicy, HISTORY_REQUEST_OF_ZERO, memoryInfo)
-    , m_chunkReceiverData(
-          getRequestQueueType(serverOptions.requestQueueFullPolicy), serverOptions.requestQueueFullPolicy, memoryInfo)
+    , m_chunkReceiverData(getRequestQueueType(serverOptions.requestQueueFullPolicy, serverOptions.requestQueueCapacity),
+                          serverOptions.requestQueueFullPolicy,
+                          memoryInfo)
     , m_offeringRequested(serverOptions.offerOnCreate)
 {
     m_chunkReceiverData.m_queue.setCapacity(serverOptions.requestQueueCapacity);
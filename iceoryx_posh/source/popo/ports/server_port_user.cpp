@@ -163,6 +163,7 @@ void ServerPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
@@ -171,6 +172,7 @@ void ServerPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        requestDiscovery();
     }
 }
 
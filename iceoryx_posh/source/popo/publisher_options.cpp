@@ -26,28 +26,34 @@ Serialization PublisherOptions::serialize() const noexcept
     return Serialization::create(historyCapacity,
                                  nodeName,
                                  offerOnCreate,
-                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy),
+                                 static_cast<std::underlying_type_t<QueueDeliveryMode>>(deliveryMode));
 }
 
 expected<PublisherOptions, Serialization::Error> PublisherOptions::deserialize(const Serialization& serialized) noexcept
 {
     using ConsumerTooSlowPolicyUT = std::underlying_type_t<ConsumerTooSlowPolicy>;
+    using QueueDeliveryModeUT = std::underlying_type_t<QueueDeliveryMode>;
 
     PublisherOptions publisherOptions;
     ConsumerTooSlowPolicyUT subscriberTooSlowPolicy{};
+    QueueDeliveryModeUT deliveryMode{};
 
     auto deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
                                                         publisherOptions.nodeName,
                                                         publisherOptions.offerOnCreate,
-                                                        subscriberTooSlowPolicy);
+                                                        subscriberTooSlowPolicy,
+                                                        deliveryMode);
 
     if (!deserializationSuccessful
-        || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
+        || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+        || deliveryMode > static_cast<QueueDeliveryModeUT>(QueueDeliveryMode::LOCK_FREE_SNAPSHOT))
     {
         return err(Serialization::Error::DESERIALIZATION_FAILED);
     }
 
     publisherOptions.subscriberTooSlowPolicy = static_cast<ConsumerTooSlowPolicy>(subscriberTooSlowPolicy);
+    publisherOptions.deliveryMode = static_cast<QueueDeliveryMode>(deliveryMode);
     return ok(publisherOptions);
 }
 } // namespace popo
@@ -69,6 +69,9 @@ mepoo::MePooConfig DefaultRouDiMemory::discoveryMemPoolConfig(const uint32_t chu
     constexpr size_t ALIGNMENT{mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT};
     mepoo::MePooConfig mempoolConfig;
     mempoolConfig.m_mempoolConfig.push_back({align(sizeof(roudi::ServiceRegistry), ALIGNMENT), chunkCount});
+    // the deltas in the history of the publisher are referenced in addition to the ones in transit
+    mempoolConfig.m_mempoolConfig.push_back(
+        {align(sizeof(roudi::ServiceRegistry::Delta), ALIGNMENT), chunkCount + SERVICE_REGISTRY_DELTA_HISTORY});
 
     mempoolConfig.optimize();
     return mempoolConfig;
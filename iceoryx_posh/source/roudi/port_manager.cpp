@@ -84,6 +84,20 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
 
+    // the deltas must stay available until the next snapshot is published in order to let late joiners catch up
+    popo::PublisherOptions registryDeltaPortOptions;
+    registryDeltaPortOptions.historyCapacity = SERVICE_REGISTRY_DELTA_HISTORY;
+    registryDeltaPortOptions.nodeName = iox::NodeName_t("Service Registry");
+    registryDeltaPortOptions.offerOnCreate = true;
+
+    m_serviceRegistryDeltaPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME},
+        registryDeltaPortOptions,
+        discoveryMemoryManager);
+
+    PublisherPortRouDiType serviceRegistryDeltaPort(*m_serviceRegistryDeltaPublisherPortData);
+    doDiscoveryForPublisherPort(serviceRegistryDeltaPort);
+
     auto maybeIntrospectionMemoryManager = m_roudiMemoryInterface->introspectionMemoryManager();
     if (!maybeIntrospectionMemoryManager.has_value())
     {
@@ -118,21 +132,31 @@ void PortManager::stopPortIntrospection() noexcept
 
 void PortManager::doDiscovery() noexcept
 {
-    handlePublisherPorts();
+    // the ports request a discovery whenever they have to be processed, without a request there is no need to visit
+    // all the ports
+    if (m_portPool->getDiscoveryNotificationData().m_portDiscoveryRequested.exchange(false, std::memory_order_acq_rel))
+    {
+        handlePublisherPorts();
 
-    handleSubscriberPorts();
+        handleSubscriberPorts();
 
-    handleServerPorts();
+        handleServerPorts();
 
-    handleClientPorts();
+        handleClientPorts();
 
-    handleInterfaces();
+        handleInterfaces();
+    }
 
     handleConditionVariables();
 
     publishServiceRegistry();
 }
 
+popo::DiscoveryNotificationData& PortManager::discoveryNotificationData() noexcept
+{
+    return m_portPool->getDiscoveryNotificationData();
+}
+
 void PortManager::handlePublisherPorts() noexcept
 {
     // get the changes of publisher port offer state
@@ -142,6 +166,10 @@ void PortManager::handlePublisherPorts() noexcept
     {
         auto currentPort = port++;
         PublisherPortRouDiType publisherPort(currentPort.to_ptr());
+        if (!publisherPort.acquireDiscoveryRequest())
+        {
+            continue;
+        }
 
         doDiscoveryForPublisherPort(publisherPort);
 
@@ -191,6 +219,10 @@ void PortManager::handleSubscriberPorts() noexcept
     {
         auto currentPort = port++;
         SubscriberPortType subscriberPort(currentPort.to_ptr());
+        if (!subscriberPort.acquireDiscoveryRequest())
+        {
+            continue;
+        }
 
         doDiscoveryForSubscriberPort(subscriberPort);
 
@@ -275,6 +307,10 @@ void PortManager::handleClientPorts() noexcept
     {
         auto currentPort = port++;
         popo::ClientPortRouDi clientPort(*currentPort);
+        if (!clientPort.acquireDiscoveryRequest())
+        {
+            continue;
+        }
 
         doDiscoveryForClientPort(clientPort);
 
@@ -373,6 +409,10 @@ void PortManager::handleServerPorts() noexcept
     {
         auto currentPort = port++;
         popo::ServerPortRouDi serverPort(*currentPort);
+        if (!serverPort.acquireDiscoveryRequest())
+        {
+            continue;
+        }
 
         doDiscoveryForServerPort(serverPort);
 
@@ -424,6 +464,11 @@ void PortManager::handleInterfaces() noexcept
     while (port != interfacePorts.end())
     {
         auto currentPort = port++;
+        if (!popo::InterfacePort(currentPort.to_ptr()).acquireDiscoveryRequest())
+        {
+            continue;
+        }
+
         if (currentPort->m_doInitialOfferForward)
         {
             interfacePortsForInitialForwarding.push_back(currentPort.to_ptr());
@@ -756,6 +801,7 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
+        m_serviceRegistryDeltaPublisherPortData.reset();
     }
     auto& publisherPorts = m_portPool->getPublisherPortDataList();
     auto publisherPort = publisherPorts.begin();
@@ -1091,16 +1137,86 @@ void PortManager::publishServiceRegistry() noexcept
 {
     if (!m_serviceRegistry.hasDataChangedSinceLastCall())
     {
+        m_pendingServiceRegistryChanges.clear();
+        m_havePendingServiceRegistryChangesOverflowed = false;
         return;
     }
 
-    if (!m_serviceRegistryPublisherPortData.has_value())
+    if (!m_serviceRegistryPublisherPortData.has_value() || !m_serviceRegistryDeltaPublisherPortData.has_value())
     {
         // should not happen (except during RouDi shutdown)
-        // the port always exists, otherwise we would terminate during startup
+        // the ports always exist, otherwise we would terminate during startup
         IOX_LOG(Warn, "Could not publish service registry!");
         return;
     }
+
+    // a snapshot is published when the deltas since the last snapshot would not fit into the history anymore, this
+    // guarantees that the latest snapshot and the subsequent deltas are sufficient to reconstruct the registry
+    const uint64_t numberOfDeltas = (m_pendingServiceRegistryChanges.size() + ServiceRegistry::Delta::CAPACITY - 1U)
+                                    / ServiceRegistry::Delta::CAPACITY;
+    const bool isSnapshotRequired = m_serviceRegistry.version() == 0U || m_havePendingServiceRegistryChangesOverflowed
+                                    || m_numberOfDeltasSinceServiceRegistrySnapshot + numberOfDeltas
+                                           > SERVICE_REGISTRY_DELTA_HISTORY;
+
+    if (isSnapshotRequired || !publishServiceRegistryDeltas())
+    {
+        publishServiceRegistrySnapshot();
+    }
+
+    m_pendingServiceRegistryChanges.clear();
+    m_havePendingServiceRegistryChangesOverflowed = false;
+}
+
+bool PortManager::publishServiceRegistryDeltas() noexcept
+{
+    PublisherPortUserType publisher(m_serviceRegistryDeltaPublisherPortData.value());
+
+    uint64_t changeIndex{0U};
+    while (changeIndex < m_pendingServiceRegistryChanges.size())
+    {
+        auto maybeChunk = publisher.tryAllocateChunk(sizeof(ServiceRegistry::Delta),
+                                                     alignof(ServiceRegistry::Delta),
+                                                     CHUNK_NO_USER_HEADER_SIZE,
+                                                     CHUNK_NO_USER_HEADER_ALIGNMENT);
+        if (maybeChunk.has_error())
+        {
+            IOX_LOG(Warn, "Could not allocate a chunk for the service registry delta! Publishing a snapshot instead.");
+            return false;
+        }
+
+        auto* chunk = maybeChunk.value();
+        auto* delta = new (chunk->userPayload()) ServiceRegistry::Delta();
+        for (; changeIndex < m_pendingServiceRegistryChanges.size()
+             && delta->changes.size() < ServiceRegistry::Delta::CAPACITY;
+             ++changeIndex)
+        {
+            const auto& service = m_pendingServiceRegistryChanges[changeIndex];
+            // the absolute counters are transferred; no entry in the registry means that the service was removed
+            delta->changes.emplace_back(service);
+            m_serviceRegistry.find(service.getServiceIDString(),
+                                   service.getInstanceIDString(),
+                                   service.getEventIDString(),
+                                   [&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+                                       delta->changes.back().publisherCount = entry.publisherCount;
+                                       delta->changes.back().serverCount = entry.serverCount;
+                                   });
+        }
+
+        delta->baseVersion = m_serviceRegistry.version();
+        m_serviceRegistry.incrementVersion();
+        delta->version = m_serviceRegistry.version();
+        ++m_numberOfDeltasSinceServiceRegistrySnapshot;
+
+        publisher.sendChunk(chunk);
+    }
+
+    return true;
+}
+
+void PortManager::publishServiceRegistrySnapshot() noexcept
+{
+    m_serviceRegistry.incrementVersion();
+
     PublisherPortUserType publisher(m_serviceRegistryPublisherPortData.value());
     publisher
         .tryAllocateChunk(sizeof(ServiceRegistry),
@@ -1114,6 +1230,41 @@ void PortManager::publishServiceRegistry() noexcept
             publisher.sendChunk(chunk);
         })
         .or_else([](auto&) { IOX_LOG(Warn, "Could not allocate a chunk for the service registry!"); });
+
+    // an empty delta on top of the snapshot notifies the service discoveries which wait for deltas; those which are
+    // not at the version of the snapshot detect the gap and take the snapshot
+    PublisherPortUserType deltaPublisher(m_serviceRegistryDeltaPublisherPortData.value());
+    deltaPublisher
+        .tryAllocateChunk(sizeof(ServiceRegistry::Delta),
+                          alignof(ServiceRegistry::Delta),
+                          CHUNK_NO_USER_HEADER_SIZE,
+                          CHUNK_NO_USER_HEADER_ALIGNMENT)
+        .and_then([&](auto& chunk) {
+            auto* delta = new (chunk->userPayload()) ServiceRegistry::Delta();
+            delta->baseVersion = m_serviceRegistry.version();
+            delta->version = m_serviceRegistry.version();
+
+            deltaPublisher.sendChunk(chunk);
+        })
+        .or_else([](auto&) { IOX_LOG(Warn, "Could not allocate a chunk for the service registry delta!"); });
+
+    m_numberOfDeltasSinceServiceRegistrySnapshot = 1U;
+}
+
+void PortManager::addPendingServiceRegistryChange(const capro::ServiceDescription& service) noexcept
+{
+    for (const auto& pendingService : m_pendingServiceRegistryChanges)
+    {
+        if (pendingService == service)
+        {
+            return;
+        }
+    }
+
+    if (!m_pendingServiceRegistryChanges.push_back(service))
+    {
+        m_havePendingServiceRegistryChangesOverflowed = true;
+    }
 }
 
 const ServiceRegistry& PortManager::serviceRegistry() const noexcept
@@ -1123,28 +1274,34 @@ const ServiceRegistry& PortManager::serviceRegistry() const noexcept
 
 void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
-    m_serviceRegistry.addPublisher(service).or_else([&](auto&) {
-        IOX_LOG(Warn, "Could not add publisher with service description '" << service << "' to service registry!");
-        IOX_REPORT(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, iox::er::RUNTIME_ERROR);
-    });
+    m_serviceRegistry.addPublisher(service)
+        .and_then([&]() { addPendingServiceRegistryChange(service); })
+        .or_else([&](auto&) {
+            IOX_LOG(Warn, "Could not add publisher with service description '" << service << "' to service registry!");
+            IOX_REPORT(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, iox::er::RUNTIME_ERROR);
+        });
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removePublisher(service);
+    addPendingServiceRegistryChange(service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
-    m_serviceRegistry.addServer(service).or_else([&](auto&) {
-        IOX_LOG(Warn, "Could not add server with service description '" << service << "' to service registry!");
-        IOX_REPORT(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, iox::er::RUNTIME_ERROR);
-    });
+    m_serviceRegistry.addServer(service)
+        .and_then([&]() { addPendingServiceRegistryChange(service); })
+        .or_else([&](auto&) {
+            IOX_LOG(Warn, "Could not add server with service description '" << service << "' to service registry!");
+            IOX_REPORT(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, iox::er::RUNTIME_ERROR);
+        });
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removeServer(service);
+    addPendingServiceRegistryChange(service);
 }
 
 expected<popo::ConditionVariableData*, PortPoolError>
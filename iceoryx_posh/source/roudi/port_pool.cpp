@@ -38,6 +38,11 @@ PortPoolData::CondVarContainer& PortPool::getConditionVariableDataList() noexcep
     return m_portPoolData->m_conditionVariableMembers;
 }
 
+popo::DiscoveryNotificationData& PortPool::getDiscoveryNotificationData() noexcept
+{
+    return m_portPoolData->m_discoveryNotificationData;
+}
+
 expected<popo::InterfacePortData*, PortPoolError>
 PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interfaces commInterface) noexcept
 {
@@ -49,6 +54,7 @@ PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interf
         IOX_REPORT(PoshError::PORT_POOL__INTERFACELIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::INTERFACE_PORT_LIST_FULL);
     }
+    connectToDiscovery(*interfacePortData);
     return ok(interfacePortData.to_ptr());
 }
 
@@ -102,6 +108,7 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__PUBLISHERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::PUBLISHER_PORT_LIST_FULL);
     }
+    connectToDiscovery(*publisherPortData);
     return ok(publisherPortData.to_ptr());
 }
 
@@ -121,6 +128,7 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__SUBSCRIBERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::SUBSCRIBER_PORT_LIST_FULL);
     }
+    connectToDiscovery(*subscriberPortData);
     return ok(subscriberPortData);
 }
 
@@ -151,6 +159,7 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__CLIENTLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::CLIENT_PORT_LIST_FULL);
     }
+    connectToDiscovery(*clientPortData);
     return ok(clientPortData.to_ptr());
 }
 
@@ -171,6 +180,7 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__SERVERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::SERVER_PORT_LIST_FULL);
     }
+    connectToDiscovery(*serverPortData);
     return ok(serverPortData.to_ptr());
 }
 
@@ -193,5 +203,12 @@ void PortPool::removeServerPort(const popo::ServerPortData* const portData) noex
     m_portPoolData->m_serverPortMembers.erase(portData);
 }
 
+void PortPool::connectToDiscovery(popo::BasePortData& portData) noexcept
+{
+    portData.m_discoveryNotificationDataPtr = &m_portPoolData->m_discoveryNotificationData;
+    // new ports might already request an offer or a subscription on creation
+    popo::BasePort(&portData).requestDiscovery();
+}
+
 } // namespace roudi
 } // namespace iox
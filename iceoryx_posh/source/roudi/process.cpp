@@ -19,6 +19,7 @@
 #include "iceoryx_platform/types.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/detail/convert.hpp"
 #include "iox/logging.hpp"
 
 using namespace iox::units::duration_literals;
@@ -60,6 +61,60 @@ void Process::sendViaIpcChannel(const runtime::IpcMessage& data) noexcept
     }
 }
 
+void Process::sendViaIpcChannel(const runtime::IpcBinaryMessage& data) noexcept
+{
+    bool sendSuccess = m_ipcChannel.send(data);
+    if (!sendSuccess)
+    {
+        IOX_LOG(Warn, "Process cannot send binary message over communication channel");
+        IOX_REPORT(PoshError::POSH__ROUDI_PROCESS_SEND_VIA_IPC_CHANNEL_FAILED, iox::er::RUNTIME_ERROR);
+    }
+}
+
+void Process::sendPortAcknowledgement(const runtime::IpcMessageType acknowledgement,
+                                      const UntypedRelativePointer::offset_t offset,
+                                      const segment_id_underlying_t segmentId) noexcept
+{
+    if (m_ipcMessageProtocolVersion == runtime::IpcBinaryMessage::TEXT_PROTOCOL_VERSION)
+    {
+        runtime::IpcMessage sendBuffer;
+        sendBuffer << runtime::IpcMessageTypeToString(acknowledgement) << convert::toString(offset)
+                   << convert::toString(segmentId);
+        sendViaIpcChannel(sendBuffer);
+        return;
+    }
+
+    runtime::IpcBinaryMessage sendBuffer{acknowledgement};
+    sendBuffer << offset << segmentId;
+    sendViaIpcChannel(sendBuffer);
+}
+
+void Process::sendErrorResponse(const runtime::IpcMessageErrorType error) noexcept
+{
+    if (m_ipcMessageProtocolVersion == runtime::IpcBinaryMessage::TEXT_PROTOCOL_VERSION)
+    {
+        runtime::IpcMessage sendBuffer;
+        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE)
+                   << runtime::IpcMessageErrorTypeToString(error);
+        sendViaIpcChannel(sendBuffer);
+        return;
+    }
+
+    runtime::IpcBinaryMessage sendBuffer{runtime::IpcMessageType::ERROR_RESPONSE};
+    sendBuffer << error;
+    sendViaIpcChannel(sendBuffer);
+}
+
+uint8_t Process::getIpcMessageProtocolVersion() const noexcept
+{
+    return m_ipcMessageProtocolVersion;
+}
+
+void Process::setIpcMessageProtocolVersion(const uint8_t version) noexcept
+{
+    m_ipcMessageProtocolVersion = version;
+}
+
 uint64_t Process::getSessionId() noexcept
 {
     return m_sessionId.load(std::memory_order_relaxed);
@@ -22,6 +22,7 @@
 #include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/detail/convert.hpp"
 #include "iox/logging.hpp"
 #include "iox/posix_call.hpp"
@@ -225,7 +226,8 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
                                      const bool isMonitored,
                                      const int64_t transmissionTimestamp,
                                      const uint64_t sessionId,
-                                     const version::VersionInfo& versionInfo) noexcept
+                                     const version::VersionInfo& versionInfo,
+                                     const uint8_t ipcMessageProtocolVersion) noexcept
 {
     bool returnValue{false};
 
@@ -257,13 +259,20 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
             else
             {
                 // try registration again, should succeed since removal was successful
-                returnValue =
-                    this->addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
+                returnValue = this->addProcess(name,
+                                               pid,
+                                               user,
+                                               isMonitored,
+                                               transmissionTimestamp,
+                                               sessionId,
+                                               versionInfo,
+                                               ipcMessageProtocolVersion);
             }
         })
         .or_else([&]() {
             // process does not exist in list and can be added
-            returnValue = this->addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
+            returnValue = this->addProcess(
+                name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo, ipcMessageProtocolVersion);
         });
 
     return returnValue;
@@ -275,7 +284,8 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
                                 const bool isMonitored,
                                 const int64_t transmissionTimestamp,
                                 const uint64_t sessionId,
-                                const version::VersionInfo& versionInfo) noexcept
+                                const version::VersionInfo& versionInfo,
+                                const uint8_t ipcMessageProtocolVersion) noexcept
 {
     if (!version::VersionInfo::getCurrentVersion().checkCompatibility(versionInfo, m_compatibilityCheckLevel))
     {
@@ -306,13 +316,18 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
     }
     m_processList.emplace_back(name, m_domainId, pid, user, heartbeatPoolIndex, sessionId);
 
+    // both sides use the highest IPC message protocol version they have in common for the port requests
+    const uint8_t negotiatedProtocolVersion =
+        algorithm::minVal(ipcMessageProtocolVersion, runtime::IpcBinaryMessage::PROTOCOL_VERSION);
+    m_processList.back().setIpcMessageProtocolVersion(negotiatedProtocolVersion);
+
     // send REG_ACK and BaseAddrString
     runtime::IpcMessage sendBuffer;
 
     auto segmentManagerOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, m_segmentManager);
     sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK)
                << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << segmentManagerOffset << transmissionTimestamp
-               << m_mgmtSegmentId << heartbeatOffset;
+               << m_mgmtSegmentId << heartbeatOffset << static_cast<uint32_t>(negotiatedProtocolVersion);
 
     m_processList.back().sendViaIpcChannel(sendBuffer);
 
@@ -361,7 +376,12 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
         m_portManager.deletePortsOfProcess(processIter->getName());
         m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
 
-        if (feedback == TerminationFeedback::SEND_ACK_TO_PROCESS)
+        if (feedback == TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS)
+        {
+            // the process terminated without flushing the chunk caches of its threads
+            m_segmentManager->reclaimChunkCaches(processIter->getPid());
+        }
+        else
         {
             // Reply with TERMINATION_ACK and let process shutdown
             runtime::IpcMessage sendBuffer;
@@ -427,10 +447,8 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
                 // send SubscriberPort to app as a serialized relative pointer
                 auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
 
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
+                process->sendPortAcknowledgement(
+                    runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK, offset, m_mgmtSegmentId);
 
                 IOX_LOG(Debug,
                         "Created new SubscriberPort for application '" << name << "' with service description '"
@@ -438,10 +456,7 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
             }
             else
             {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
-                process->sendViaIpcChannel(sendBuffer);
+                process->sendErrorResponse(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
                 IOX_LOG(Error,
                         "Could not create SubscriberPort for application '" << name << "' with service description '"
                                                                             << service << "'");
@@ -466,11 +481,7 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
             if (!segmentInfo.m_memoryManager.has_value())
             {
                 // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
+                process->sendErrorResponse(runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
                 return;
             }
 
@@ -482,10 +493,8 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                 // send PublisherPort to app as a serialized relative pointer
                 auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
 
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
+                process->sendPortAcknowledgement(
+                    runtime::IpcMessageType::CREATE_PUBLISHER_ACK, offset, m_mgmtSegmentId);
 
                 IOX_LOG(Debug,
                         "Created new PublisherPort for application '" << name << "' with service description '"
@@ -493,32 +502,27 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
             }
             else
             {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-
-                std::string error;
+                runtime::IpcMessageErrorType error{runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL};
                 switch (maybePublisher.error())
                 {
                 case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
                 {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+                    error = runtime::IpcMessageErrorType::NO_UNIQUE_CREATED;
                     break;
                 }
                 case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
                 {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+                    error = runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN;
                     break;
                 }
                 default:
                 {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+                    error = runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL;
                     break;
                 }
                 }
-                sendBuffer << error;
+                process->sendErrorResponse(error);
 
-                process->sendViaIpcChannel(sendBuffer);
                 IOX_LOG(Error,
                         "Could not create PublisherPort for application '" << name << "' with service description '"
                                                                            << service << "'");
@@ -543,11 +547,7 @@ void ProcessManager::addClientForProcess(const RuntimeName_t& name,
             if (!segmentInfo.m_memoryManager.has_value())
             {
                 // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
+                process->sendErrorResponse(runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
                 return;
             }
 
@@ -558,20 +558,15 @@ void ProcessManager::addClientForProcess(const RuntimeName_t& name,
                     auto relativePtrToClientPort =
                         UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, clientPort);
 
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CLIENT_ACK)
-                               << convert::toString(relativePtrToClientPort) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+                    process->sendPortAcknowledgement(
+                        runtime::IpcMessageType::CREATE_CLIENT_ACK, relativePtrToClientPort, m_mgmtSegmentId);
 
                     IOX_LOG(Debug,
                             "Created new ClientPort for application '" << name << "' with service description '"
                                                                        << service << "'");
                 })
                 .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
+                    process->sendErrorResponse(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
 
                     IOX_LOG(Error,
                             "Could not create ClientPort for application '" << name << "' with service description '"
@@ -597,11 +592,7 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
             if (!segmentInfo.m_memoryManager.has_value())
             {
                 // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
+                process->sendErrorResponse(runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
                 return;
             }
 
@@ -612,20 +603,15 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
                     auto relativePtrToServerPort =
                         UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, serverPort);
 
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SERVER_ACK)
-                               << convert::toString(relativePtrToServerPort) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+                    process->sendPortAcknowledgement(
+                        runtime::IpcMessageType::CREATE_SERVER_ACK, relativePtrToServerPort, m_mgmtSegmentId);
 
                     IOX_LOG(Debug,
                             "Created new ServerPort for application '" << name << "' with service description '"
                                                                        << service << "'");
                 })
                 .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
+                    process->sendErrorResponse(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
 
                     IOX_LOG(Error,
                             "Could not create ServerPort for application '" << name << "' with service description '"
@@ -647,23 +633,15 @@ void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtime
                 .and_then([&](auto condVar) {
                     auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, condVar);
 
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(
-                        runtime::IpcMessageType::CREATE_CONDITION_VARIABLE_ACK)
-                               << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+                    process->sendPortAcknowledgement(
+                        runtime::IpcMessageType::CREATE_CONDITION_VARIABLE_ACK, offset, m_mgmtSegmentId);
 
                     IOX_LOG(Debug, "Created new ConditionVariable for application " << runtimeName);
                 })
                 .or_else([&](PortPoolError error) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
-                    if (error == PortPoolError::CONDITION_VARIABLE_LIST_FULL)
-                    {
-                        sendBuffer << runtime::IpcMessageErrorTypeToString(
-                            runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL);
-                    }
-                    process->sendViaIpcChannel(sendBuffer);
+                    process->sendErrorResponse((error == PortPoolError::CONDITION_VARIABLE_LIST_FULL)
+                                                   ? runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL
+                                                   : runtime::IpcMessageErrorType::NOTYPE);
 
                     IOX_LOG(Debug, "Could not create new ConditionVariable for application " << runtimeName);
                 });
@@ -17,10 +17,13 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
-#include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/deadline_timer.hpp"
 #include "iox/detail/convert.hpp"
 #include "iox/detail/system_configuration.hpp"
 #include "iox/logging.hpp"
@@ -83,12 +86,30 @@ RouDi::~RouDi() noexcept
 
 void RouDi::startProcessRuntimeMessagesThread() noexcept
 {
-    m_handleRuntimeMessageThread =
-        std::thread(&RouDi::processRuntimeMessages,
-                    this,
-                    runtime::IpcInterfaceCreator::create(
-                        IPC_CHANNEL_ROUDI_NAME, m_roudiConfig.domainId, ResourceType::ICEORYX_DEFINED)
-                        .expect("Creating IPC channel for request to RouDi"));
+    m_roudiIpcInterface.emplace(runtime::IpcInterfaceCreator::create(
+                                    IPC_CHANNEL_ROUDI_NAME, m_roudiConfig.domainId, ResourceType::ICEORYX_DEFINED)
+                                    .expect("Creating IPC channel for request to RouDi"));
+
+    auto numberOfThreads = m_roudiConfig.runtimeMessagesThreadCount;
+    if (numberOfThreads == 0U || numberOfThreads > MAX_RUNTIME_MESSAGES_THREADS)
+    {
+        numberOfThreads = algorithm::minVal(algorithm::maxVal(numberOfThreads, 1U), MAX_RUNTIME_MESSAGES_THREADS);
+        IOX_LOG(Warn,
+                "The number of runtime message threads must be in the range of [1, "
+                    << MAX_RUNTIME_MESSAGES_THREADS << "]! Using " << numberOfThreads << " threads.");
+    }
+
+    IOX_LOG(Info, "Resource prefix: " << IOX_DEFAULT_RESOURCE_PREFIX);
+    IOX_LOG(Info, "Domain ID: " << static_cast<DomainId::value_type>(m_roudiConfig.domainId));
+    IOX_LOG(Info, "RouDi is ready for clients");
+    fflush(stdout); // explicitly flush 'stdout' for 'launch_testing'
+
+    // a runtime waits for the response to a request before it sends the next one, therefore the requests of a single
+    // runtime are still processed in order when the threads receive from the same IPC channel
+    for (uint32_t i = 0U; i < numberOfThreads; ++i)
+    {
+        m_handleRuntimeMessageThreads.emplace_back(&RouDi::processRuntimeMessages, this);
+    }
 }
 
 void RouDi::shutdown() noexcept
@@ -96,7 +117,7 @@ void RouDi::shutdown() noexcept
     // trigger the shutdown of the monitoring and discovery thread in order to prevent application to register while
     // shutting down
     m_runMonitoringAndDiscoveryThread = false;
-    m_discoveryLoopTrigger.trigger();
+    triggerDiscoveryLoop();
 
     // stop the introspection
     m_processIntrospection.stop();
@@ -161,11 +182,14 @@ void RouDi::shutdown() noexcept
     // Postpone the IpcChannelThread in order to receive TERMINATION
     m_runHandleRuntimeMessageThread = false;
 
-    if (m_handleRuntimeMessageThread.joinable())
+    for (auto& thread : m_handleRuntimeMessageThreads)
     {
-        IOX_LOG(Debug, "Joining 'IPC-msg-process' thread...");
-        m_handleRuntimeMessageThread.join();
-        IOX_LOG(Debug, "...'IPC-msg-process' thread joined.");
+        if (thread.joinable())
+        {
+            IOX_LOG(Debug, "Joining 'IPC-msg-process' thread...");
+            thread.join();
+            IOX_LOG(Debug, "...'IPC-msg-process' thread joined.");
+        }
     }
 }
 
@@ -189,7 +213,7 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
                             << static_cast<uint32_t>(error));
             });
     }
-    m_discoveryLoopTrigger.trigger();
+    triggerDiscoveryLoop();
     m_discoveryFinishedSemaphore->timedWait(timeout).or_else([](const auto& error) {
         IOX_LOG(Error,
                 "A timed wait on the semaphore which signals a finished run of the "
@@ -198,27 +222,31 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
     });
 }
 
+void RouDi::triggerDiscoveryLoop() noexcept
+{
+    popo::ConditionNotifier(m_portManager->discoveryNotificationData().m_conditionVariableData,
+                            popo::DiscoveryNotificationData::TRIGGER_NOTIFICATION_INDEX)
+        .notify();
+}
+
 void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     setThreadName("Mon+Discover");
 
-    class DiscoveryWaitSet : public popo::WaitSet<1>
-    {
-      public:
-        DiscoveryWaitSet(popo::ConditionVariableData& condVarData) noexcept
-            : WaitSet(condVarData)
-        {
-        }
-    };
-
-    popo::ConditionVariableData conditionVariableData;
-    DiscoveryWaitSet discoveryLoopWaitset{conditionVariableData};
-    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach a single event");
+    // the ports notify this listener when they have to be processed; the process monitoring runs on its own timer
+    popo::ConditionListener discoveryListener(m_portManager->discoveryNotificationData().m_conditionVariableData);
+    deadline_timer monitoringTimer(DISCOVERY_INTERVAL);
     bool manuallyTriggered{false};
 
     while (m_runMonitoringAndDiscoveryThread)
     {
-        m_prcMgr->run();
+        if (monitoringTimer.hasExpired())
+        {
+            m_prcMgr->monitorProcesses();
+            monitoringTimer.reset();
+        }
+
+        m_prcMgr->discoveryUpdate();
 
         cyclicUpdateHook();
 
@@ -232,34 +260,34 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
         }
 
         manuallyTriggered = false;
-        for (const auto& notification : discoveryLoopWaitset.timedWait(DISCOVERY_INTERVAL))
+        for (const auto notificationIndex : discoveryListener.timedWait(monitoringTimer.remainingTime()))
         {
-            if (notification->doesOriginateFrom(&m_discoveryLoopTrigger))
+            if (notificationIndex == popo::DiscoveryNotificationData::TRIGGER_NOTIFICATION_INDEX)
             {
                 manuallyTriggered = true;
-                break;
             }
         }
     }
 }
 
-void RouDi::processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterface) noexcept
+void RouDi::processRuntimeMessages() noexcept
 {
-    auto roudiIpc = std::move(roudiIpcInterface);
-
     setThreadName("IPC-msg-process");
 
-    IOX_LOG(Info, "Resource prefix: " << IOX_DEFAULT_RESOURCE_PREFIX);
-    IOX_LOG(Info, "Domain ID: " << static_cast<DomainId::value_type>(m_roudiConfig.domainId));
-    IOX_LOG(Info, "RouDi is ready for clients");
-    fflush(stdout); // explicitly flush 'stdout' for 'launch_testing'
-
     while (m_runHandleRuntimeMessageThread)
     {
-        // read RouDi's IPC channel
+        // read RouDi's IPC channel; runtimes which negotiated the binary protocol send binary frames for the
+        // port requests while all other requests are still text messages
         runtime::IpcMessage message;
-        if (roudiIpc.timedReceive(m_runtimeMessagesThreadTimeout, message))
+        runtime::IpcBinaryMessage binaryMessage;
+        if (m_roudiIpcInterface->timedReceive(m_runtimeMessagesThreadTimeout, message, binaryMessage))
         {
+            if (binaryMessage.isValid())
+            {
+                processBinaryMessage(binaryMessage);
+                continue;
+            }
+
             auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
             RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
 
@@ -271,7 +299,8 @@ void RouDi::processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterf
 version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& message,
                                                  uint32_t& pid,
                                                  iox_uid_t& userId,
-                                                 int64_t& transmissionTimestamp) noexcept
+                                                 int64_t& transmissionTimestamp,
+                                                 uint8_t& ipcMessageProtocolVersion) noexcept
 {
     convert::from_string<uint32_t>(message.getElementAtIndex(2).c_str()).and_then([&pid](const auto value) {
         pid = value;
@@ -282,36 +311,54 @@ version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& mess
     convert::from_string<int64_t>(message.getElementAtIndex(4).c_str())
         .and_then([&transmissionTimestamp](const auto value) { transmissionTimestamp = value; });
 
+    // runtimes which do not send a protocol version only understand text messages
+    ipcMessageProtocolVersion = runtime::IpcBinaryMessage::TEXT_PROTOCOL_VERSION;
+    if (message.getNumberOfElements() > 6)
+    {
+        convert::from_string<uint8_t>(message.getElementAtIndex(6).c_str())
+            .and_then([&ipcMessageProtocolVersion](const auto value) { ipcMessageProtocolVersion = value; });
+    }
+
     Serialization serializationVersionInfo(message.getElementAtIndex(5));
     return serializationVersionInfo;
 }
 
-void RouDi::processMessage(const runtime::IpcMessage& message,
-                           const iox::runtime::IpcMessageType& cmd,
-                           const RuntimeName_t& runtimeName) noexcept
+bool RouDi::isValidRuntimeName(const RuntimeName_t& runtimeName) noexcept
 {
     if (runtimeName.empty())
     {
         IOX_LOG(Error, "Got message with empty runtime name!");
-        return;
+        return false;
     }
 
-
     for (const auto s : platform::IOX_PATH_SEPARATORS)
     {
         const char separator[2]{s};
         if (runtimeName.find(separator).has_value())
         {
             IOX_LOG(Error, "Got message with a runtime name with invalid characters: \"" << runtimeName << "\"!");
-            return;
+            return false;
         }
     }
 
+    return true;
+}
+
+void RouDi::processMessage(const runtime::IpcMessage& message,
+                           const iox::runtime::IpcMessageType& cmd,
+                           const RuntimeName_t& runtimeName) noexcept
+{
+    if (!isValidRuntimeName(runtimeName))
+    {
+        return;
+    }
+
     switch (cmd)
     {
     case runtime::IpcMessageType::REG:
     {
-        if (message.getNumberOfElements() != 6)
+        // the 7th element with the IPC message protocol version is optional for compatibility with older runtimes
+        if (message.getNumberOfElements() != 6 && message.getNumberOfElements() != 7)
         {
             IOX_LOG(Error,
                     "Wrong number of parameters for \"IpcMessageType::REG\" from \"" << runtimeName << "\"received!");
@@ -321,14 +368,17 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             uint32_t pid{0U};
             iox_uid_t userId{0};
             int64_t transmissionTimestamp{0};
-            version::VersionInfo versionInfo = parseRegisterMessage(message, pid, userId, transmissionTimestamp);
+            uint8_t ipcMessageProtocolVersion{runtime::IpcBinaryMessage::TEXT_PROTOCOL_VERSION};
+            version::VersionInfo versionInfo =
+                parseRegisterMessage(message, pid, userId, transmissionTimestamp, ipcMessageProtocolVersion);
 
             registerProcess(runtimeName,
                             pid,
                             PosixUser{userId},
                             transmissionTimestamp,
                             getUniqueSessionIdForProcess(),
-                            versionInfo);
+                            versionInfo,
+                            ipcMessageProtocolVersion);
         }
         break;
     }
@@ -555,23 +605,120 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     }
 }
 
+void RouDi::processBinaryMessage(runtime::IpcBinaryMessage& message) noexcept
+{
+    const auto cmd = message.getMessageType();
+    RuntimeName_t runtimeName;
+    message >> runtimeName;
+
+    if (!message.isValid())
+    {
+        IOX_LOG(Error, "Got binary message without a runtime name!");
+        return;
+    }
+
+    if (!isValidRuntimeName(runtimeName))
+    {
+        return;
+    }
+
+    auto isCompletelyDeserialized = [&] {
+        if (!message.isValid() || !message.isFullyExtracted())
+        {
+            IOX_LOG(Error,
+                    "Deserialization of binary message \"" << runtime::IpcMessageTypeToString(cmd) << "\" from \""
+                                                           << runtimeName << "\" failed!");
+            return false;
+        }
+        return true;
+    };
+
+    switch (cmd)
+    {
+    case runtime::IpcMessageType::CREATE_PUBLISHER:
+    {
+        capro::ServiceDescription service;
+        popo::PublisherOptions publisherOptions;
+        runtime::PortConfigInfo portConfigInfo;
+        message >> service >> publisherOptions >> portConfigInfo;
+        if (isCompletelyDeserialized())
+        {
+            m_prcMgr->addPublisherForProcess(runtimeName, service, publisherOptions, portConfigInfo);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+    {
+        capro::ServiceDescription service;
+        popo::SubscriberOptions subscriberOptions;
+        runtime::PortConfigInfo portConfigInfo;
+        message >> service >> subscriberOptions >> portConfigInfo;
+        if (isCompletelyDeserialized())
+        {
+            m_prcMgr->addSubscriberForProcess(runtimeName, service, subscriberOptions, portConfigInfo);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_CLIENT:
+    {
+        capro::ServiceDescription service;
+        popo::ClientOptions clientOptions;
+        runtime::PortConfigInfo portConfigInfo;
+        message >> service >> clientOptions >> portConfigInfo;
+        if (isCompletelyDeserialized())
+        {
+            m_prcMgr->addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_SERVER:
+    {
+        capro::ServiceDescription service;
+        popo::ServerOptions serverOptions;
+        runtime::PortConfigInfo portConfigInfo;
+        message >> service >> serverOptions >> portConfigInfo;
+        if (isCompletelyDeserialized())
+        {
+            m_prcMgr->addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_CONDITION_VARIABLE:
+    {
+        if (isCompletelyDeserialized())
+        {
+            m_prcMgr->addConditionVariableForProcess(runtimeName);
+        }
+        break;
+    }
+    default:
+    {
+        IOX_LOG(Error, "Unknown binary IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]");
+
+        m_prcMgr->sendMessageNotSupportedToRuntime(runtimeName);
+        break;
+    }
+    }
+}
+
 void RouDi::registerProcess(const RuntimeName_t& name,
                             const uint32_t pid,
                             const PosixUser user,
                             const int64_t transmissionTimestamp,
                             const uint64_t sessionId,
-                            const version::VersionInfo& versionInfo) noexcept
+                            const version::VersionInfo& versionInfo,
+                            const uint8_t ipcMessageProtocolVersion) noexcept
 {
     bool monitorProcess = (m_roudiConfig.monitoringMode == roudi::MonitoringMode::ON
                            && !m_roudiConfig.sharesAddressSpaceWithApplications);
-    IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+    IOX_DISCARD_RESULT(m_prcMgr->registerProcess(
+        name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo, ipcMessageProtocolVersion));
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
-    return ++sessionId;
+    static concurrent::Atomic<uint64_t> sessionId{0U};
+    return sessionId.fetch_add(1U, std::memory_order_relaxed) + 1U;
 }
 
 void RouDi::IpcMessageErrorHandler() noexcept
@@ -39,10 +39,11 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"termination-delay", required_argument, nullptr, 't'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"runtime-message-threads", required_argument, nullptr, 'r'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:r:";
     int index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -92,6 +93,15 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             std::cout << "                                  SIGKILL to application which did not respond" << std::endl;
             std::cout << "                                  to the initial SIGTERM signal." << std::endl;
             std::cout << "                                  default = '45'" << std::endl;
+            std::cout << "-r, --runtime-message-threads <UINT>" << std::endl;
+            std::cout << "                                  Sets the number of threads which process the" << std::endl;
+            std::cout << "                                  requests of the applications. With more than" << std::endl;
+            std::cout << "                                  one thread, the requests of different" << std::endl;
+            std::cout << "                                  applications are processed concurrently which" << std::endl;
+            std::cout << "                                  speeds up the startup of many applications." << std::endl;
+            std::cout << "                                  <UINT> 1.." << roudi::MAX_RUNTIME_MESSAGES_THREADS
+                      << std::endl;
+            std::cout << "                                  default = '1'" << std::endl;
 
             m_cmdLineArgs.run = false;
             break;
@@ -220,6 +230,21 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             m_cmdLineArgs.roudiConfig.processKillDelay = units::Duration::fromSeconds(maybeValue.value());
             break;
         }
+        case 'r':
+        {
+            auto maybeValue = convert::from_string<uint32_t>(optarg);
+            if (!maybeValue.has_value() || maybeValue.value() == 0U
+                || maybeValue.value() > roudi::MAX_RUNTIME_MESSAGES_THREADS)
+            {
+                IOX_LOG(Error,
+                        "The number of runtime message threads must be in the range of [1, "
+                            << roudi::MAX_RUNTIME_MESSAGES_THREADS << "]");
+                return err(CmdLineParserResult::INVALID_PARAMETER);
+            }
+
+            m_cmdLineArgs.roudiConfig.runtimeMessagesThreadCount = maybeValue.value();
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
@@ -23,6 +23,7 @@
 #include "iox/into.hpp"
 #include "iox/logging.hpp"
 #include "iox/posix_group.hpp"
+#include "iox/posix_shared_memory_object.hpp"
 #include "iox/std_string_support.hpp"
 #include "iox/string.hpp"
 #include "iox/vector.hpp"
@@ -148,6 +149,37 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
         auto writer = segment->get_as<std::string>("writer").value_or(into<std::string>(groupOfCurrentProcess));
         auto reader = segment->get_as<std::string>("reader").value_or(into<std::string>(groupOfCurrentProcess));
         iox::mepoo::MePooConfig mempoolConfig;
+
+        auto sizeClassLookup = segment->get_as<std::string>("size-class-lookup").value_or("binary-search");
+        if (sizeClassLookup == "binary-search")
+        {
+            mempoolConfig.m_sizeClassLookup = iox::mepoo::SizeClassLookup::BINARY_SEARCH;
+        }
+        else if (sizeClassLookup == "linear-search")
+        {
+            mempoolConfig.m_sizeClassLookup = iox::mepoo::SizeClassLookup::LINEAR_SEARCH;
+        }
+        else
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_SIZE_CLASS_LOOKUP);
+        }
+
+        if (segment->get_as<bool>("overflow-to-larger-mempool").value_or(false))
+        {
+            mempoolConfig.m_overflowPolicy = iox::mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL;
+        }
+
+        auto& segmentMemoryOptions = mempoolConfig.m_segmentMemoryOptions;
+        segmentMemoryOptions.m_prefault = segment->get_as<bool>("prefault").value_or(false);
+        segmentMemoryOptions.m_transparentHugePages = segment->get_as<bool>("transparent-huge-pages").value_or(false);
+        segmentMemoryOptions.m_lockMemory = segment->get_as<bool>("lock-memory").value_or(false);
+        auto zeroingThreads = segment->get_as<int64_t>("zeroing-threads").value_or(1);
+        if (zeroingThreads < 1 || zeroingThreads > PosixSharedMemoryObjectBuilder::MAX_NUMBER_OF_ZEROING_THREADS)
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_NUMBER_OF_ZEROING_THREADS);
+        }
+        segmentMemoryOptions.m_zeroingThreads = static_cast<uint32_t>(zeroingThreads);
+
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -163,6 +195,7 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
         {
             auto chunkSize = mempool->get_as<uint64_t>("size");
             auto chunkCount = mempool->get_as<uint32_t>("count");
+            auto chunkCacheDepth = mempool->get_as<uint32_t>("chunk-cache-depth").value_or(0U);
             if (!chunkSize)
             {
                 return iox::err(iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_SIZE);
@@ -171,7 +204,7 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
             {
                 return iox::err(iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT);
             }
-            mempoolConfig.addMemPool({*chunkSize, *chunkCount});
+            mempoolConfig.addMemPool({*chunkSize, *chunkCount, chunkCacheDepth});
         }
         parsedConfig.m_sharedMemorySegments.push_back(
             {PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
@@ -41,43 +41,39 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
         return ok();
     }
 
-    // entry does not exist, find a free slot if it exists
-
-    // fast path to a free slot (which was occupied by previously removed entry),
-    // prefer to fill entries close to the front
-    if (m_freeIndex != NO_INDEX)
+    index = insert(serviceDescription);
+    if (index == NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
-        m_freeIndex = NO_INDEX;
-        return ok();
+        return err(Error::SERVICE_REGISTRY_FULL);
     }
 
-    // search from start
-    for (auto& entry : m_serviceDescriptions)
+    (*m_serviceDescriptions[index]).*count = 1U;
+    return ok();
+}
+
+uint32_t ServiceRegistry::insert(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    // reuse a slot of a previously removed entry or append a new one
+    uint32_t index{NO_INDEX};
+    if (!m_freeIndices.empty())
     {
-        if (!entry)
-        {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            m_dataChanged = true;
-            return ok();
-        }
+        index = m_freeIndices.back();
+        m_freeIndices.pop_back();
     }
-
-    // append new entry at the end (the size only grows up to capacity)
-    if (m_serviceDescriptions.emplace_back())
+    else if (m_serviceDescriptions.emplace_back())
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
-        return ok();
+        // the size only grows up to capacity
+        index = static_cast<uint32_t>(m_serviceDescriptions.size() - 1U);
+    }
+    else
+    {
+        return NO_INDEX;
     }
 
-    return err(Error::SERVICE_REGISTRY_FULL);
+    m_serviceDescriptions[index].emplace(serviceDescription);
+    addToIndices(index);
+    m_dataChanged = true;
+    return index;
 }
 
 expected<void, ServiceRegistry::Error>
@@ -103,10 +99,7 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
         {
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                remove(index);
             }
         }
     }
@@ -123,10 +116,7 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
         {
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                remove(index);
             }
         }
     }
@@ -137,48 +127,322 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
-        m_dataChanged = true;
+        remove(index);
     }
 }
 
+void ServiceRegistry::remove(const uint32_t index) noexcept
+{
+    removeFromIndices(index);
+    m_serviceDescriptions[index].reset();
+    // reuse the slot in the next insertion
+    m_freeIndices.push_back(index);
+    m_dataChanged = true;
+}
+
 void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& instance,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    if (service && instance && event)
     {
-        if (entry)
+        auto index = findIndex(*service, *instance, *event);
+        if (index != NO_INDEX)
         {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+            callable(*m_serviceDescriptions[index]);
+        }
+        return;
+    }
 
-            if (match)
-            {
-                callable(*entry);
-            }
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) indexed by IdString
+    const optional<capro::IdString_t>* searchedIdStrings[NUMBER_OF_ID_STRINGS]{&service, &instance, &event};
+
+    // iterate over the shortest chain of all given ID strings and filter the remaining ones
+    uint32_t shortestChainSlot{NO_SLOT};
+    uint32_t shortestChainIdString{NUMBER_OF_ID_STRINGS};
+    uint32_t shortestChainLength{NO_INDEX + 1U};
+    for (uint32_t i = 0U; i < NUMBER_OF_ID_STRINGS; ++i)
+    {
+        const auto& searchedIdString = *searchedIdStrings[i];
+        if (!searchedIdString)
+        {
+            continue;
+        }
+
+        const auto idString = static_cast<IdString>(i);
+        const auto slot = findIdStringSlot(idString, *searchedIdString, hash(*searchedIdString, i));
+        if (slot == NO_SLOT)
+        {
+            return;
+        }
+        const auto chainLength = m_idStringIndex[i][slot].chainLength;
+        if (chainLength < shortestChainLength)
+        {
+            shortestChainLength = chainLength;
+            shortestChainSlot = slot;
+            shortestChainIdString = i;
+        }
+    }
+
+    if (shortestChainSlot == NO_SLOT)
+    {
+        forEach(callable);
+        return;
+    }
+
+    for (auto index = m_idStringIndex[shortestChainIdString][shortestChainSlot].entryIndex; index != NO_INDEX;
+         index = m_chainLinks[index].next[shortestChainIdString])
+    {
+        const auto& entry = *m_serviceDescriptions[index];
+        bool match = (service) ? (entry.serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry.serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry.serviceDescription.getEventIDString() == *event) : true;
+
+        if (match)
+        {
+            callable(entry);
         }
     }
 }
 
 uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    return findIndex(serviceDescription.getServiceIDString(),
+                     serviceDescription.getInstanceIDString(),
+                     serviceDescription.getEventIDString());
+}
+
+uint32_t ServiceRegistry::findIndex(const capro::IdString_t& service,
+                                    const capro::IdString_t& instance,
+                                    const capro::IdString_t& event) const noexcept
+{
+    const auto serviceDescriptionHash = hash(service, instance, event);
+    for (auto position = serviceDescriptionHash % HASH_TABLE_CAPACITY;
+         m_serviceDescriptionIndex[position].entryIndex != NO_INDEX;
+         position = (position + 1U) % HASH_TABLE_CAPACITY)
     {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
+        const auto& slot = m_serviceDescriptionIndex[position];
+        if (slot.hash != serviceDescriptionHash)
+        {
+            continue;
+        }
+        const auto& serviceDescription = m_serviceDescriptions[slot.entryIndex]->serviceDescription;
+        if (serviceDescription.getServiceIDString() == service && serviceDescription.getInstanceIDString() == instance
+            && serviceDescription.getEventIDString() == event)
         {
-            return i;
+            return slot.entryIndex;
         }
     }
     return NO_INDEX;
 }
 
+uint32_t ServiceRegistry::findIdStringSlot(const IdString idString,
+                                           const capro::IdString_t& value,
+                                           const uint32_t hash) const noexcept
+{
+    const auto& table = m_idStringIndex[static_cast<uint32_t>(idString)];
+    for (auto position = hash % HASH_TABLE_CAPACITY; table[position].entryIndex != NO_INDEX;
+         position = (position + 1U) % HASH_TABLE_CAPACITY)
+    {
+        const auto& slot = table[position];
+        if (slot.hash == hash
+            && getIdString(m_serviceDescriptions[slot.entryIndex]->serviceDescription, idString) == value)
+        {
+            return position;
+        }
+    }
+    return NO_SLOT;
+}
+
+void ServiceRegistry::addToIndices(const uint32_t index) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+
+    HashSlot serviceDescriptionSlot;
+    serviceDescriptionSlot.entryIndex = index;
+    serviceDescriptionSlot.hash = hash(serviceDescription);
+    insertIntoHashTable(m_serviceDescriptionIndex, serviceDescriptionSlot);
+
+    for (uint32_t i = 0U; i < NUMBER_OF_ID_STRINGS; ++i)
+    {
+        auto& links = m_chainLinks[index];
+        links.next[i] = NO_INDEX;
+        links.previous[i] = NO_INDEX;
+
+        const auto& value = getIdString(serviceDescription, static_cast<IdString>(i));
+        const auto valueHash = hash(value, i);
+        const auto position = findIdStringSlot(static_cast<IdString>(i), value, valueHash);
+        if (position == NO_SLOT)
+        {
+            HashSlot chainSlot;
+            chainSlot.entryIndex = index;
+            chainSlot.lastEntryIndex = index;
+            chainSlot.chainLength = 1U;
+            chainSlot.hash = valueHash;
+            insertIntoHashTable(m_idStringIndex[i], chainSlot);
+            continue;
+        }
+
+        // keep the chain sorted by the entry index to report the entries in the same order as 'forEach'; new entries
+        // are usually appended at the end of the container therefore the search starts at the back of the chain
+        auto& chainSlot = m_idStringIndex[i][position];
+        auto previous = chainSlot.lastEntryIndex;
+        while (previous != NO_INDEX && previous > index)
+        {
+            previous = m_chainLinks[previous].previous[i];
+        }
+        const auto next = (previous == NO_INDEX) ? chainSlot.entryIndex : m_chainLinks[previous].next[i];
+
+        links.previous[i] = previous;
+        links.next[i] = next;
+        if (previous == NO_INDEX)
+        {
+            chainSlot.entryIndex = index;
+        }
+        else
+        {
+            m_chainLinks[previous].next[i] = index;
+        }
+        if (next == NO_INDEX)
+        {
+            chainSlot.lastEntryIndex = index;
+        }
+        else
+        {
+            m_chainLinks[next].previous[i] = index;
+        }
+        ++chainSlot.chainLength;
+    }
+}
+
+void ServiceRegistry::removeFromIndices(const uint32_t index) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+
+    for (auto position = hash(serviceDescription) % HASH_TABLE_CAPACITY;
+         m_serviceDescriptionIndex[position].entryIndex != NO_INDEX;
+         position = (position + 1U) % HASH_TABLE_CAPACITY)
+    {
+        if (m_serviceDescriptionIndex[position].entryIndex == index)
+        {
+            eraseFromHashTable(m_serviceDescriptionIndex, position);
+            break;
+        }
+    }
+
+    for (uint32_t i = 0U; i < NUMBER_OF_ID_STRINGS; ++i)
+    {
+        const auto& value = getIdString(serviceDescription, static_cast<IdString>(i));
+        const auto position = findIdStringSlot(static_cast<IdString>(i), value, hash(value, i));
+        if (position == NO_SLOT)
+        {
+            continue;
+        }
+
+        auto& chainSlot = m_idStringIndex[i][position];
+        if (--chainSlot.chainLength == 0U)
+        {
+            eraseFromHashTable(m_idStringIndex[i], position);
+            continue;
+        }
+
+        const auto previous = m_chainLinks[index].previous[i];
+        const auto next = m_chainLinks[index].next[i];
+        if (previous == NO_INDEX)
+        {
+            chainSlot.entryIndex = next;
+        }
+        else
+        {
+            m_chainLinks[previous].next[i] = next;
+        }
+        if (next == NO_INDEX)
+        {
+            chainSlot.lastEntryIndex = previous;
+        }
+        else
+        {
+            m_chainLinks[next].previous[i] = previous;
+        }
+    }
+}
+
+const capro::IdString_t& ServiceRegistry::getIdString(const capro::ServiceDescription& serviceDescription,
+                                                      const IdString idString) noexcept
+{
+    switch (idString)
+    {
+    case IdString::SERVICE:
+        return serviceDescription.getServiceIDString();
+    case IdString::INSTANCE:
+        return serviceDescription.getInstanceIDString();
+    case IdString::EVENT:
+        break;
+    }
+    return serviceDescription.getEventIDString();
+}
+
+uint32_t ServiceRegistry::hash(const capro::IdString_t& value, const uint32_t seed) noexcept
+{
+    // FNV-1a
+    constexpr uint32_t FNV_OFFSET_BASIS{2166136261U};
+    constexpr uint32_t FNV_PRIME{16777619U};
+    uint32_t result{FNV_OFFSET_BASIS ^ seed};
+    const auto* data = value.c_str();
+    for (uint64_t i = 0U; i < value.size(); ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounded by the string size
+        result ^= static_cast<uint8_t>(data[i]);
+        result *= FNV_PRIME;
+    }
+    return result;
+}
+
+uint32_t ServiceRegistry::hash(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return hash(serviceDescription.getServiceIDString(),
+                serviceDescription.getInstanceIDString(),
+                serviceDescription.getEventIDString());
+}
+
+uint32_t ServiceRegistry::hash(const capro::IdString_t& service,
+                               const capro::IdString_t& instance,
+                               const capro::IdString_t& event) noexcept
+{
+    return hash(event, hash(instance, hash(service, 0U)));
+}
+
+void ServiceRegistry::insertIntoHashTable(HashTable_t& table, const HashSlot& slot) noexcept
+{
+    // the table has more slots than the registry has entries, therefore there is always an empty slot
+    auto position = slot.hash % HASH_TABLE_CAPACITY;
+    while (table[position].entryIndex != NO_INDEX)
+    {
+        position = (position + 1U) % HASH_TABLE_CAPACITY;
+    }
+    table[position] = slot;
+}
+
+void ServiceRegistry::eraseFromHashTable(HashTable_t& table, uint32_t position) noexcept
+{
+    // backward shift deletion, the following slots of the probe sequence are moved up so that no tombstones are
+    // required and the probe sequences do not degrade over time
+    for (auto next = (position + 1U) % HASH_TABLE_CAPACITY; table[next].entryIndex != NO_INDEX;
+         next = (next + 1U) % HASH_TABLE_CAPACITY)
+    {
+        const auto home = table[next].hash % HASH_TABLE_CAPACITY;
+        const bool isHomeBetweenPositionAndNext =
+            (position < next) ? (position < home && home <= next) : (position < home || home <= next);
+        if (!isHomeBetweenPositionAndNext)
+        {
+            table[position] = table[next];
+            position = next;
+        }
+    }
+    table[position] = HashSlot();
+}
+
 void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
     for (auto& entry : m_serviceDescriptions)
@@ -197,5 +461,53 @@ bool ServiceRegistry::hasDataChangedSinceLastCall() noexcept
     return dataChanged;
 }
 
+uint64_t ServiceRegistry::version() const noexcept
+{
+    return m_version;
+}
+
+void ServiceRegistry::incrementVersion() noexcept
+{
+    ++m_version;
+}
+
+bool ServiceRegistry::applyDelta(const Delta& delta) noexcept
+{
+    if (delta.baseVersion != m_version)
+    {
+        return false;
+    }
+
+    for (const auto& change : delta.changes)
+    {
+        auto index = findIndex(change.serviceDescription);
+        if (change.publisherCount == 0U && change.serverCount == 0U)
+        {
+            if (index != NO_INDEX)
+            {
+                remove(index);
+            }
+            continue;
+        }
+
+        if (index == NO_INDEX)
+        {
+            index = insert(change.serviceDescription);
+            if (index == NO_INDEX)
+            {
+                return false;
+            }
+        }
+
+        auto& entry = m_serviceDescriptions[index];
+        entry->publisherCount = change.publisherCount;
+        entry->serverCount = change.serverCount;
+    }
+
+    m_version = delta.version;
+    m_dataChanged = true;
+    return true;
+}
+
 } // namespace roudi
 } // namespace iox
@@ -0,0 +1,350 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace runtime
+{
+namespace
+{
+// a COBS code byte denotes the number of following non-zero bytes plus one; the maximum code does not imply a zero
+constexpr uint8_t COBS_MAX_CODE{0xFFU};
+
+template <typename Enum>
+bool isValidEnumValue(const std::underlying_type_t<Enum> value, const Enum maxValue) noexcept
+{
+    return value <= static_cast<std::underlying_type_t<Enum>>(maxValue);
+}
+} // namespace
+
+constexpr uint8_t IpcBinaryMessage::PROTOCOL_VERSION;
+constexpr uint8_t IpcBinaryMessage::TEXT_PROTOCOL_VERSION;
+constexpr char IpcBinaryMessage::FRAME_MARKER;
+constexpr uint64_t IpcBinaryMessage::MAX_FRAME_SIZE;
+constexpr uint64_t IpcBinaryMessage::MAX_PAYLOAD_SIZE;
+constexpr uint64_t IpcBinaryMessage::HEADER_SIZE;
+
+IpcBinaryMessage::IpcBinaryMessage(const IpcMessageType messageType) noexcept
+    : m_isValid(true)
+{
+    const auto type = static_cast<std::underlying_type_t<IpcMessageType>>(messageType);
+    write(&PROTOCOL_VERSION, sizeof(PROTOCOL_VERSION));
+    write(&type, sizeof(type));
+}
+
+IpcMessageType IpcBinaryMessage::getMessageType() const noexcept
+{
+    using UnderlyingType = std::underlying_type_t<IpcMessageType>;
+    if (!m_isValid || m_size < HEADER_SIZE)
+    {
+        return IpcMessageType::NOTYPE;
+    }
+
+    UnderlyingType type{0};
+    std::memcpy(&type, &m_buffer[sizeof(PROTOCOL_VERSION)], sizeof(type));
+    if (static_cast<UnderlyingType>(IpcMessageType::BEGIN) >= type
+        || static_cast<UnderlyingType>(IpcMessageType::END) <= type)
+    {
+        return IpcMessageType::NOTYPE;
+    }
+    return static_cast<IpcMessageType>(type);
+}
+
+bool IpcBinaryMessage::isValid() const noexcept
+{
+    return m_isValid;
+}
+
+uint64_t IpcBinaryMessage::size() const noexcept
+{
+    return m_size;
+}
+
+void IpcBinaryMessage::invalidate() noexcept
+{
+    m_isValid = false;
+}
+
+bool IpcBinaryMessage::isFullyExtracted() const noexcept
+{
+    return m_readPosition == m_size;
+}
+
+bool IpcBinaryMessage::write(const void* data, const uint64_t size) noexcept
+{
+    if (!m_isValid || m_size + size > MAX_PAYLOAD_SIZE)
+    {
+        m_isValid = false;
+        return false;
+    }
+    std::memcpy(&m_buffer[m_size], data, static_cast<size_t>(size));
+    m_size += size;
+    return true;
+}
+
+bool IpcBinaryMessage::read(void* data, const uint64_t size) noexcept
+{
+    if (!m_isValid || m_readPosition + size > m_size)
+    {
+        m_isValid = false;
+        return false;
+    }
+    std::memcpy(data, &m_buffer[m_readPosition], static_cast<size_t>(size));
+    m_readPosition += size;
+    return true;
+}
+
+bool IpcBinaryMessage::encode(Frame_t& frame) const noexcept
+{
+    if (!m_isValid)
+    {
+        return false;
+    }
+
+    bool isEncoded{false};
+    frame.unsafe_raw_access([&](char* str, const auto info) -> uint64_t {
+        // frame marker, payload, one code byte per started block of 254 bytes and the null-terminator
+        const uint64_t requiredSize{1U + m_size + m_size / 254U + 1U + 1U};
+        if (requiredSize > info.total_size)
+        {
+            str[0] = '\0';
+            return 0U;
+        }
+
+        str[0] = FRAME_MARKER;
+        uint64_t codePosition{1U};
+        uint64_t writePosition{2U};
+        uint8_t code{1U};
+        for (uint64_t i = 0U; i < m_size; ++i)
+        {
+            if (m_buffer[i] != 0U)
+            {
+                str[writePosition++] = static_cast<char>(m_buffer[i]);
+                ++code;
+            }
+            if (m_buffer[i] == 0U || code == COBS_MAX_CODE)
+            {
+                str[codePosition] = static_cast<char>(code);
+                codePosition = writePosition++;
+                code = 1U;
+            }
+        }
+        str[codePosition] = static_cast<char>(code);
+        str[writePosition] = '\0';
+        isEncoded = true;
+        return writePosition;
+    });
+    return isEncoded;
+}
+
+bool IpcBinaryMessage::decode(const char* frame, const uint64_t frameSize) noexcept
+{
+    m_size = 0U;
+    m_readPosition = HEADER_SIZE;
+    m_isValid = false;
+
+    if (frameSize < 2U || frame[0] != FRAME_MARKER)
+    {
+        return false;
+    }
+
+    uint64_t readPosition{1U};
+    while (readPosition < frameSize)
+    {
+        const auto code = static_cast<uint8_t>(frame[readPosition++]);
+        if (code == 0U || readPosition + code - 1U > frameSize || m_size + code - 1U > MAX_PAYLOAD_SIZE)
+        {
+            return false;
+        }
+        std::memcpy(&m_buffer[m_size], &frame[readPosition], static_cast<size_t>(code - 1U));
+        m_size += code - 1U;
+        readPosition += code - 1U;
+
+        if (code != COBS_MAX_CODE && readPosition < frameSize)
+        {
+            if (m_size >= MAX_PAYLOAD_SIZE)
+            {
+                return false;
+            }
+            m_buffer[m_size++] = 0U;
+        }
+    }
+
+    m_isValid = (m_size >= HEADER_SIZE && m_buffer[0] == PROTOCOL_VERSION);
+    return m_isValid;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const capro::ServiceDescription& service) noexcept
+{
+    const auto classHash = service.getClassHash();
+    message << service.getServiceIDString() << service.getInstanceIDString() << service.getEventIDString();
+    for (uint64_t i = 0U; i < capro::CLASS_HASH_ELEMENT_COUNT; ++i)
+    {
+        message << classHash[i];
+    }
+    return message << service.getScope() << service.getSourceInterface();
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, capro::ServiceDescription& service) noexcept
+{
+    capro::IdString_t serviceString;
+    capro::IdString_t instanceString;
+    capro::IdString_t eventString;
+    capro::ServiceDescription::ClassHash classHash;
+    std::underlying_type_t<capro::Scope> scope{0U};
+    std::underlying_type_t<capro::Interfaces> commInterface{0U};
+
+    message >> serviceString >> instanceString >> eventString;
+    for (uint64_t i = 0U; i < capro::CLASS_HASH_ELEMENT_COUNT; ++i)
+    {
+        message >> classHash[i];
+    }
+    message >> scope >> commInterface;
+
+    if (!message.isValid() || scope >= static_cast<std::underlying_type_t<capro::Scope>>(capro::Scope::INVALID)
+        || commInterface >= static_cast<std::underlying_type_t<capro::Interfaces>>(capro::Interfaces::INTERFACE_END))
+    {
+        message.invalidate();
+        return message;
+    }
+
+    service = capro::ServiceDescription(
+        serviceString, instanceString, eventString, classHash, static_cast<capro::Interfaces>(commInterface));
+    if (static_cast<capro::Scope>(scope) == capro::Scope::LOCAL)
+    {
+        service.setLocal();
+    }
+    return message;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::PublisherOptions& options) noexcept
+{
+    return message << options.historyCapacity << options.nodeName << options.offerOnCreate
+                   << options.subscriberTooSlowPolicy << options.deliveryMode;
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::PublisherOptions& options) noexcept
+{
+    std::underlying_type_t<popo::ConsumerTooSlowPolicy> subscriberTooSlowPolicy{0U};
+    std::underlying_type_t<popo::QueueDeliveryMode> deliveryMode{0U};
+    message >> options.historyCapacity >> options.nodeName >> options.offerOnCreate >> subscriberTooSlowPolicy
+        >> deliveryMode;
+
+    if (!isValidEnumValue(subscriberTooSlowPolicy, popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+        || !isValidEnumValue(deliveryMode, popo::QueueDeliveryMode::LOCK_FREE_SNAPSHOT))
+    {
+        message.invalidate();
+        return message;
+    }
+    options.subscriberTooSlowPolicy = static_cast<popo::ConsumerTooSlowPolicy>(subscriberTooSlowPolicy);
+    options.deliveryMode = static_cast<popo::QueueDeliveryMode>(deliveryMode);
+    return message;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::SubscriberOptions& options) noexcept
+{
+    return message << options.queueCapacity << options.historyRequest << options.nodeName
+                   << options.subscribeOnCreate << options.queueFullPolicy << options.requiresPublisherHistorySupport;
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::SubscriberOptions& options) noexcept
+{
+    std::underlying_type_t<popo::QueueFullPolicy> queueFullPolicy{0U};
+    message >> options.queueCapacity >> options.historyRequest >> options.nodeName >> options.subscribeOnCreate
+        >> queueFullPolicy >> options.requiresPublisherHistorySupport;
+
+    if (!isValidEnumValue(queueFullPolicy, popo::QueueFullPolicy::DISCARD_OLDEST_DATA))
+    {
+        message.invalidate();
+        return message;
+    }
+    options.queueFullPolicy = static_cast<popo::QueueFullPolicy>(queueFullPolicy);
+    return message;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::ClientOptions& options) noexcept
+{
+    return message << options.responseQueueCapacity << options.nodeName << options.connectOnCreate
+                   << options.responseQueueFullPolicy << options.serverTooSlowPolicy;
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::ClientOptions& options) noexcept
+{
+    std::underlying_type_t<popo::QueueFullPolicy> responseQueueFullPolicy{0U};
+    std::underlying_type_t<popo::ConsumerTooSlowPolicy> serverTooSlowPolicy{0U};
+    message >> options.responseQueueCapacity >> options.nodeName >> options.connectOnCreate >> responseQueueFullPolicy
+        >> serverTooSlowPolicy;
+
+    if (!isValidEnumValue(responseQueueFullPolicy, popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
+        || !isValidEnumValue(serverTooSlowPolicy, popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
+    {
+        message.invalidate();
+        return message;
+    }
+    options.responseQueueFullPolicy = static_cast<popo::QueueFullPolicy>(responseQueueFullPolicy);
+    options.serverTooSlowPolicy = static_cast<popo::ConsumerTooSlowPolicy>(serverTooSlowPolicy);
+    return message;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::ServerOptions& options) noexcept
+{
+    return message << options.requestQueueCapacity << options.nodeName << options.offerOnCreate
+                   << options.requestQueueFullPolicy << options.clientTooSlowPolicy;
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::ServerOptions& options) noexcept
+{
+    std::underlying_type_t<popo::QueueFullPolicy> requestQueueFullPolicy{0U};
+    std::underlying_type_t<popo::ConsumerTooSlowPolicy> clientTooSlowPolicy{0U};
+    message >> options.requestQueueCapacity >> options.nodeName >> options.offerOnCreate >> requestQueueFullPolicy
+        >> clientTooSlowPolicy;
+
+    if (!isValidEnumValue(requestQueueFullPolicy, popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
+        || !isValidEnumValue(clientTooSlowPolicy, popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
+    {
+        message.invalidate();
+        return message;
+    }
+    options.requestQueueFullPolicy = static_cast<popo::QueueFullPolicy>(requestQueueFullPolicy);
+    options.clientTooSlowPolicy = static_cast<popo::ConsumerTooSlowPolicy>(clientTooSlowPolicy);
+    return message;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const PortConfigInfo& portConfigInfo) noexcept
+{
+    return message << portConfigInfo.portType << portConfigInfo.memoryInfo.deviceId
+                   << portConfigInfo.memoryInfo.memoryType;
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, PortConfigInfo& portConfigInfo) noexcept
+{
+    return message >> portConfigInfo.portType >> portConfigInfo.memoryInfo.deviceId
+           >> portConfigInfo.memoryInfo.memoryType;
+}
+
+} // namespace runtime
+} // namespace iox
@@ -154,6 +154,62 @@ bool IpcInterface<IpcChannelType>::timedReceive(const units::Duration timeout, I
            && answer.isValid();
 }
 
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::receive(IpcBinaryMessage& answer) const noexcept
+{
+    if (!m_ipcChannel.has_value())
+    {
+        IOX_LOG(Warn,
+                "Trying to receive data on an non-initialized IPC interface! Interface name: " << m_interfaceName);
+        return false;
+    }
+
+    auto frame = m_ipcChannel->receive();
+    if (frame.has_error())
+    {
+        return false;
+    }
+
+    if (!answer.decode(frame.value()))
+    {
+        IOX_LOG(Error, "The received message is not a valid binary message");
+        return false;
+    }
+    return true;
+}
+
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::timedReceive(const units::Duration timeout,
+                                                IpcMessage& answer,
+                                                IpcBinaryMessage& binaryAnswer) const noexcept
+{
+    if (!m_ipcChannel.has_value())
+    {
+        IOX_LOG(Warn,
+                "Trying to receive data on an non-initialized IPC interface! Interface name: " << m_interfaceName);
+        return false;
+    }
+
+    binaryAnswer = IpcBinaryMessage();
+    auto message = m_ipcChannel->timedReceive(timeout);
+    if (message.has_error())
+    {
+        return false;
+    }
+
+    if (IpcBinaryMessage::isFrame(message.value()))
+    {
+        if (!binaryAnswer.decode(message.value()))
+        {
+            IOX_LOG(Error, "The received binary message is not valid");
+            return false;
+        }
+        return true;
+    }
+
+    return IpcInterface<IpcChannelType>::setMessageFromString(message.value().c_str(), answer);
+}
+
 template <typename IpcChannelType>
 bool IpcInterface<IpcChannelType>::setMessageFromString(const char* buffer, IpcMessage& answer) noexcept
 {
@@ -193,6 +249,36 @@ bool IpcInterface<IpcChannelType>::send(const IpcMessage& msg) const noexcept
     return !m_ipcChannel->send(msg.getMessage()).or_else(logLengthError).has_error();
 }
 
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::send(const IpcBinaryMessage& msg) const noexcept
+{
+    if (!m_ipcChannel.has_value())
+    {
+        IOX_LOG(Warn, "Trying to send data on an non-initialized IPC interface! Interface name: " << m_interfaceName);
+        return false;
+    }
+
+    IpcBinaryMessage::Frame_t frame;
+    if (!msg.encode(frame))
+    {
+        IOX_LOG(Error,
+                "Trying to send the binary message of type " << static_cast<int32_t>(msg.getMessageType())
+                                                             << " which is invalid or does not fit into a frame");
+        return false;
+    }
+
+    return !m_ipcChannel->send(frame)
+                .or_else([&frame](PosixIpcChannelError& error) {
+                    if (error == PosixIpcChannelError::MESSAGE_TOO_LONG)
+                    {
+                        IOX_LOG(Error,
+                                "frame size of " << frame.size() + platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE
+                                                 << " bigger than configured max message size");
+                    }
+                })
+                .has_error();
+}
+
 template <typename IpcChannelType>
 bool IpcInterface<IpcChannelType>::timedSend(const IpcMessage& msg, units::Duration timeout) const noexcept
 {
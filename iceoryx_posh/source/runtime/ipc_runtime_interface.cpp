@@ -103,7 +103,8 @@ expected<IpcRuntimeInterface, IpcRuntimeInterfaceError> IpcRuntimeInterface::cre
             sendBuffer << IpcMessageTypeToString(IpcMessageType::REG) << runtimeName << convert::toString(pid)
                        << convert::toString(PosixUser::getUserOfCurrentProcess().getID())
                        << convert::toString(transmissionTimestamp)
-                       << static_cast<Serialization>(version::VersionInfo::getCurrentVersion()).toString();
+                       << static_cast<Serialization>(version::VersionInfo::getCurrentVersion()).toString()
+                       << convert::toString(static_cast<uint32_t>(IpcBinaryMessage::PROTOCOL_VERSION));
 
             bool successfullySent = roudiIpcInterface.timedSend(sendBuffer, 100_ms);
 
@@ -185,6 +186,28 @@ bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage&
     return true;
 }
 
+bool IpcRuntimeInterface::sendRequestToRouDi(const IpcBinaryMessage& msg, IpcBinaryMessage& answer) noexcept
+{
+    if (!m_RoudiIpcInterface.send(msg))
+    {
+        IOX_LOG(Error, "Could not send binary request via RouDi IPC channel interface.\n");
+        return false;
+    }
+
+    if (!m_AppIpcInterface.receive(answer))
+    {
+        IOX_LOG(Error, "Could not receive binary response via App IPC channel interface.\n");
+        return false;
+    }
+
+    return true;
+}
+
+uint8_t IpcRuntimeInterface::getIpcMessageProtocolVersion() const noexcept
+{
+    return m_mgmtShmCharacteristics.ipcMessageProtocolVersion;
+}
+
 uint64_t IpcRuntimeInterface::getShmTopicSize() noexcept
 {
     return m_mgmtShmCharacteristics.shmTopicSize;
@@ -247,8 +270,12 @@ IpcRuntimeInterface::waitForRegAck(int64_t transmissionTimestamp,
 
             if (stringToIpcMessageType(cmd.c_str()) == IpcMessageType::REG_ACK)
             {
-                constexpr uint32_t REGISTER_ACK_PARAMETERS = 6U;
-                if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
+                // a RouDi without support for binary messages does not send the negotiated protocol version
+                constexpr uint32_t REGISTER_ACK_PARAMETERS_WITHOUT_PROTOCOL_VERSION = 6U;
+                constexpr uint32_t REGISTER_ACK_PARAMETERS = 7U;
+                const auto numberOfParameters = receiveBuffer.getNumberOfElements();
+                if (numberOfParameters != REGISTER_ACK_PARAMETERS
+                    && numberOfParameters != REGISTER_ACK_PARAMETERS_WITHOUT_PROTOCOL_VERSION)
                 {
                     IOX_REPORT_FATAL(PoshError::IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
                 }
@@ -286,6 +313,19 @@ IpcRuntimeInterface::waitForRegAck(int64_t transmissionTimestamp,
 
                 mgmtShmCharacteristics.segmentManagerAddressOffset = segmentManagerOffset;
 
+                mgmtShmCharacteristics.ipcMessageProtocolVersion = IpcBinaryMessage::TEXT_PROTOCOL_VERSION;
+                if (numberOfParameters == REGISTER_ACK_PARAMETERS)
+                {
+                    auto protocolVersionResult =
+                        iox::convert::from_string<uint8_t>(receiveBuffer.getElementAtIndex(6U).c_str());
+                    if (!protocolVersionResult.has_value()
+                        || protocolVersionResult.value() > IpcBinaryMessage::PROTOCOL_VERSION)
+                    {
+                        return RegAckResult::MALFORMED_RESPONSE;
+                    }
+                    mgmtShmCharacteristics.ipcMessageProtocolVersion = protocolVersionResult.value();
+                }
+
                 if (heartbeatOffset != UntypedRelativePointer::NULL_POINTER_OFFSET)
                 {
                     mgmtShmCharacteristics.heartbeatAddressOffset = heartbeatOffset;
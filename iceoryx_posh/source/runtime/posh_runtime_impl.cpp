@@ -170,12 +170,7 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         options.nodeName = m_appName;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<Serialization>(service).toString() << publisherOptions.serialize().toString()
-               << static_cast<Serialization>(portConfigInfo).toString();
-
-    auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
+    auto maybePublisher = requestPublisherFromRoudi(service, options, portConfigInfo);
     if (maybePublisher.has_error())
     {
         switch (maybePublisher.error())
@@ -224,8 +219,25 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
 }
 
 expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept
+PoshRuntimeImpl::requestPublisherFromRoudi(const capro::ServiceDescription& service,
+                                           const popo::PublisherOptions& options,
+                                           const PortConfigInfo& portConfigInfo) noexcept
 {
+    if (usesBinaryIpcMessages())
+    {
+        IpcBinaryMessage sendBuffer{IpcMessageType::CREATE_PUBLISHER};
+        sendBuffer << m_appName << service << options << portConfigInfo;
+        return requestPortFromRoudi<PublisherPortUserType::MemberType_t>(sendBuffer,
+                                             IpcMessageType::CREATE_PUBLISHER_ACK,
+                                             IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE,
+                                             IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE);
+    }
+
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
+               << static_cast<Serialization>(service).toString() << options.serialize().toString()
+               << static_cast<Serialization>(portConfigInfo).toString();
+
     IpcMessage receiveBuffer;
     if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
     {
@@ -303,12 +315,7 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
         options.nodeName = m_appName;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
-               << static_cast<Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<Serialization>(portConfigInfo).toString();
-
-    auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
+    auto maybeSubscriber = requestSubscriberFromRoudi(service, options, portConfigInfo);
 
     if (maybeSubscriber.has_error())
     {
@@ -341,8 +348,25 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
 }
 
 expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept
+PoshRuntimeImpl::requestSubscriberFromRoudi(const capro::ServiceDescription& service,
+                                            const popo::SubscriberOptions& options,
+                                            const PortConfigInfo& portConfigInfo) noexcept
 {
+    if (usesBinaryIpcMessages())
+    {
+        IpcBinaryMessage sendBuffer{IpcMessageType::CREATE_SUBSCRIBER};
+        sendBuffer << m_appName << service << options << portConfigInfo;
+        return requestPortFromRoudi<SubscriberPortUserType::MemberType_t>(sendBuffer,
+                                             IpcMessageType::CREATE_SUBSCRIBER_ACK,
+                                             IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE,
+                                             IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
+    }
+
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
+               << static_cast<Serialization>(service).toString() << options.serialize().toString()
+               << static_cast<Serialization>(portConfigInfo).toString();
+
     IpcMessage receiveBuffer;
     if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
     {
@@ -406,12 +430,7 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
         options.responseQueueCapacity = 1U;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
-               << static_cast<Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<Serialization>(portConfigInfo).toString();
-
-    auto maybeClient = requestClientFromRoudi(sendBuffer);
+    auto maybeClient = requestClientFromRoudi(service, options, portConfigInfo);
     if (maybeClient.has_error())
     {
         switch (maybeClient.error())
@@ -454,8 +473,25 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
 }
 
 expected<popo::ClientPortUser::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept
+PoshRuntimeImpl::requestClientFromRoudi(const capro::ServiceDescription& service,
+                                        const popo::ClientOptions& options,
+                                        const PortConfigInfo& portConfigInfo) noexcept
 {
+    if (usesBinaryIpcMessages())
+    {
+        IpcBinaryMessage sendBuffer{IpcMessageType::CREATE_CLIENT};
+        sendBuffer << m_appName << service << options << portConfigInfo;
+        return requestPortFromRoudi<popo::ClientPortUser::MemberType_t>(sendBuffer,
+                                             IpcMessageType::CREATE_CLIENT_ACK,
+                                             IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE,
+                                             IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE);
+    }
+
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
+               << static_cast<Serialization>(service).toString() << options.serialize().toString()
+               << static_cast<Serialization>(portConfigInfo).toString();
+
     IpcMessage receiveBuffer;
     if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
     {
@@ -519,12 +555,7 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
         options.requestQueueCapacity = 1U;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
-               << static_cast<Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<Serialization>(portConfigInfo).toString();
-
-    auto maybeServer = requestServerFromRoudi(sendBuffer);
+    auto maybeServer = requestServerFromRoudi(service, options, portConfigInfo);
     if (maybeServer.has_error())
     {
         switch (maybeServer.error())
@@ -567,8 +598,25 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
 }
 
 expected<popo::ServerPortUser::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept
+PoshRuntimeImpl::requestServerFromRoudi(const capro::ServiceDescription& service,
+                                        const popo::ServerOptions& options,
+                                        const PortConfigInfo& portConfigInfo) noexcept
 {
+    if (usesBinaryIpcMessages())
+    {
+        IpcBinaryMessage sendBuffer{IpcMessageType::CREATE_SERVER};
+        sendBuffer << m_appName << service << options << portConfigInfo;
+        return requestPortFromRoudi<popo::ServerPortUser::MemberType_t>(sendBuffer,
+                                             IpcMessageType::CREATE_SERVER_ACK,
+                                             IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE,
+                                             IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE);
+    }
+
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
+               << static_cast<Serialization>(service).toString() << options.serialize().toString()
+               << static_cast<Serialization>(portConfigInfo).toString();
+
     IpcMessage receiveBuffer;
     if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
     {
@@ -650,8 +698,22 @@ popo::InterfacePortData* PoshRuntimeImpl::getMiddlewareInterface(const capro::In
 }
 
 expected<popo::ConditionVariableData*, IpcMessageErrorType>
-PoshRuntimeImpl::requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept
+PoshRuntimeImpl::requestConditionVariableFromRoudi() noexcept
 {
+    if (usesBinaryIpcMessages())
+    {
+        IpcBinaryMessage sendBuffer{IpcMessageType::CREATE_CONDITION_VARIABLE};
+        sendBuffer << m_appName;
+        return requestPortFromRoudi<popo::ConditionVariableData>(
+            sendBuffer,
+            IpcMessageType::CREATE_CONDITION_VARIABLE_ACK,
+            IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE,
+            IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE);
+    }
+
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE) << m_appName;
+
     IpcMessage receiveBuffer;
     if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
     {
@@ -695,10 +757,7 @@ PoshRuntimeImpl::requestConditionVariableFromRoudi(const IpcMessage& sendBuffer)
 
 popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() noexcept
 {
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE) << m_appName;
-
-    auto maybeConditionVariable = requestConditionVariableFromRoudi(sendBuffer);
+    auto maybeConditionVariable = requestConditionVariableFromRoudi();
     if (maybeConditionVariable.has_error())
     {
         switch (maybeConditionVariable.error())
@@ -733,6 +792,64 @@ bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answ
     return m_ipcChannelInterface->sendRequestToRouDi(msg, answer);
 }
 
+bool PoshRuntimeImpl::usesBinaryIpcMessages() noexcept
+{
+    return m_ipcChannelInterface->getIpcMessageProtocolVersion() != IpcBinaryMessage::TEXT_PROTOCOL_VERSION;
+}
+
+template <typename PortDataType>
+expected<PortDataType*, IpcMessageErrorType>
+PoshRuntimeImpl::requestPortFromRoudi(const IpcBinaryMessage& sendBuffer,
+                                      const IpcMessageType acknowledgement,
+                                      const IpcMessageErrorType invalidResponseError,
+                                      const IpcMessageErrorType wrongResponseError) noexcept
+{
+    IpcBinaryMessage receiveBuffer;
+    if (!m_ipcChannelInterface->sendRequestToRouDi(sendBuffer, receiveBuffer))
+    {
+        IOX_LOG(Error, "Request for message type " << static_cast<int32_t>(sendBuffer.getMessageType())
+                                                   << " got invalid response!");
+        return err(invalidResponseError);
+    }
+
+    const auto responseType = receiveBuffer.getMessageType();
+    if (responseType == acknowledgement)
+    {
+        UntypedRelativePointer::offset_t offset{UntypedRelativePointer::NULL_POINTER_OFFSET};
+        segment_id_underlying_t segmentId{UntypedRelativePointer::NULL_POINTER_ID};
+        receiveBuffer >> offset >> segmentId;
+        if (receiveBuffer.isValid() && receiveBuffer.isFullyExtracted())
+        {
+            auto ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset);
+            return ok(reinterpret_cast<PortDataType*>(ptr));
+        }
+    }
+    else if (responseType == IpcMessageType::ERROR_RESPONSE)
+    {
+        using ErrorUnderlyingType = std::underlying_type_t<IpcMessageErrorType>;
+        ErrorUnderlyingType error{0};
+        receiveBuffer >> error;
+        if (receiveBuffer.isValid() && receiveBuffer.isFullyExtracted())
+        {
+            IOX_LOG(Error,
+                    "Request for message type " << static_cast<int32_t>(sendBuffer.getMessageType())
+                                                << " received no valid port from RouDi.");
+            if (static_cast<ErrorUnderlyingType>(IpcMessageErrorType::BEGIN) >= error
+                || static_cast<ErrorUnderlyingType>(IpcMessageErrorType::END) <= error)
+            {
+                return err(IpcMessageErrorType::NOTYPE);
+            }
+            return err(static_cast<IpcMessageErrorType>(error));
+        }
+    }
+
+    IOX_LOG(Error,
+            "Request for message type " << static_cast<int32_t>(sendBuffer.getMessageType())
+                                        << " got wrong response with message type "
+                                        << static_cast<int32_t>(responseType) << " from IPC channel");
+    return err(wrongResponseError);
+}
+
 // this is the callback for the m_keepAliveTimer
 void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
 {
@@ -30,8 +30,36 @@ void ServiceDiscovery::update()
 {
     // allows us to use update and hence findService concurrently
     std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+    takeNewerSnapshot();
+
+    bool hasDelta{true};
+    while (hasDelta)
+    {
+        hasDelta = m_serviceRegistryDeltaSubscriber.take()
+                       .and_then([&](popo::Sample<const roudi::ServiceRegistry::Delta>& deltaSample) {
+                           if (deltaSample->version <= m_serviceRegistry->version())
+                           {
+                               // already contained in the snapshot
+                               return;
+                           }
+                           if (!m_serviceRegistry->applyDelta(*deltaSample))
+                           {
+                               // some deltas were missed; RouDi publishes a snapshot before the deltas which are
+                               // required to catch up would leave the history
+                               takeNewerSnapshot();
+                           }
+                       })
+                       .has_value();
+    }
+}
+
+void ServiceDiscovery::takeNewerSnapshot()
+{
     m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
+        if (serviceRegistrySample->version() > m_serviceRegistry->version())
+        {
+            *m_serviceRegistry = *serviceRegistrySample;
+        }
     });
 }
 
@@ -81,7 +109,7 @@ void ServiceDiscovery::enableEvent(popo::TriggerHandle&& triggerHandle, const Se
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryDeltaSubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -98,7 +126,7 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryDeltaSubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -111,13 +139,13 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
 
 void ServiceDiscovery::invalidateTrigger(const uint64_t uniqueTriggerId)
 {
-    m_serviceRegistrySubscriber.invalidateTrigger(uniqueTriggerId);
+    m_serviceRegistryDeltaSubscriber.invalidateTrigger(uniqueTriggerId);
 }
 
 popo::WaitSetIsConditionSatisfiedCallback
 ServiceDiscovery::getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state)
 {
-    return m_serviceRegistrySubscriber.getCallbackForIsStateConditionSatisfied(state);
+    return m_serviceRegistryDeltaSubscriber.getCallbackForIsStateConditionSatisfied(state);
 }
 
 } // namespace runtime
@@ -82,7 +82,7 @@ class CMqInterfaceStartupRace_test : public Test
 
     void checkRegRequest(const IpcMessage& msg) const
     {
-        ASSERT_THAT(msg.getNumberOfElements(), Eq(6u));
+        ASSERT_THAT(msg.getNumberOfElements(), Eq(7u));
 
         std::string cmd = msg.getElementAtIndex(0);
         ASSERT_THAT(cmd.c_str(), StrEq(IpcMessageTypeToString(IpcMessageType::REG)));
@@ -17,9 +17,11 @@
 #include "iox/posh/experimental/node.hpp"
 
 #include "iceoryx_platform/stdlib.hpp"
+#include "iox/atomic.hpp"
 #include "iox/deadline_timer.hpp"
 #include "iox/detail/system_configuration.hpp"
 #include "iox/duration.hpp"
+#include "iox/std_string_support.hpp"
 #include "iox/vector.hpp"
 
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
@@ -28,6 +30,9 @@
 #include "test.hpp"
 
 #include <optional>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -574,6 +579,39 @@ TEST(Node_test, NodeAndEndpointsAreContinuouslyRecreated)
     }
 }
 
+TEST(Node_test, NodesCreatedConcurrentlyAreRegisteredWithMultipleRuntimeMessageThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d4eb6c6c-91cc-407a-829d-3c1d8373a90c");
+
+    constexpr uint32_t NUMBER_OF_NODES{8U};
+
+    auto config = MinimalIceoryxConfigBuilder().create();
+    config.runtimeMessagesThreadCount = 4U;
+    RouDiEnv roudi{config};
+
+    concurrent::Atomic<uint32_t> numberOfNodesWithPublisher{0U};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < NUMBER_OF_NODES; ++i)
+    {
+        threads.emplace_back([&numberOfNodesWithPublisher, i] {
+            const auto name = "hypnotoad" + std::to_string(i);
+            auto node = RouDiEnvNodeBuilder(into<lossy<NodeName_t>>(name))
+                            .create()
+                            .expect("Creating a node should not fail!");
+            node.publisher({"all", "glory", into<lossy<capro::IdString_t>>(name)})
+                .create<uint64_t>()
+                .and_then([&numberOfNodesWithPublisher](auto&) { ++numberOfNodesWithPublisher; });
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(numberOfNodesWithPublisher.load(), Eq(NUMBER_OF_NODES));
+}
+
 TEST(Node_test, MultipleNodeAndEndpointsAreRegisteredWithSeparateRouDiRunningInParallel)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1e527815-28d1-4a99-a9a3-cc4084018cf3");
@@ -27,6 +27,7 @@ class MePooMemoryManager_MOCK
         return iox::MAX_NUMBER_OF_MEMPOOLS;
     }
     MOCK_CONST_METHOD1(getMemPoolInfo, iox::mepoo::MemPoolInfo(uint32_t));
+    MOCK_METHOD1(collectMemPoolInfo, iox::mepoo::MemPoolInfo(uint32_t));
 };
 
 #endif // IOX_POSH_MOCKS_MEPOO_MEMORY_MANAGER_MOCK_HPP
@@ -58,6 +58,7 @@ class MockPublisherPortUser
                      const uint64_t, const uint32_t, const uint32_t, const uint32_t));
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
+    MOCK_METHOD1(sendChunks, void(const iox::span<iox::mepoo::ChunkHeader* const>));
     MOCK_METHOD0(tryGetPreviousChunk, iox::optional<iox::mepoo::ChunkHeader*>());
     MOCK_METHOD0(offer, void());
     MOCK_METHOD0(stopOffer, void());
@@ -52,6 +52,9 @@ class MockSubscriberPortUser
     MOCK_METHOD0(unsubscribe, void());
     MOCK_CONST_METHOD0(getSubscriptionState, iox::SubscribeState());
     MOCK_METHOD0(tryGetChunk, iox::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>());
+    MOCK_METHOD1(
+        tryGetChunks,
+        iox::expected<uint64_t, iox::popo::ChunkReceiveResult>(const iox::span<const iox::mepoo::ChunkHeader*>));
     MOCK_METHOD1(releaseChunk, void(const void* const));
     MOCK_METHOD0(releaseQueuedChunks, void());
     MOCK_CONST_METHOD0(hasNewChunks, bool());
@@ -79,6 +82,9 @@ class MockBaseSubscriber
     MOCK_CONST_METHOD0(hasData, bool());
     MOCK_METHOD0(hasMissedData, bool());
     MOCK_METHOD0(takeChunk, iox::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>());
+    MOCK_METHOD1(
+        takeChunks,
+        iox::expected<uint64_t, iox::popo::ChunkReceiveResult>(const iox::span<const iox::mepoo::ChunkHeader*>));
     MOCK_METHOD0(releaseQueuedData, void());
     MOCK_METHOD1(invalidateTrigger, bool(const uint64_t));
     MOCK_METHOD1(disableEvent, void(const iox::popo::SubscriberEvent));
@@ -17,6 +17,8 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
@@ -218,4 +220,55 @@ TYPED_TEST(BasePort_test, CallingGetRuntimeNameWorks)
     EXPECT_THAT(this->sut.getRuntimeName(), Eq(expectedProcessName<PortData_t>()));
 }
 
+TYPED_TEST(BasePort_test, NewPortHasDiscoveryRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f8e910e1-b5df-4017-9021-62a9d2db64db");
+    EXPECT_TRUE(this->sut.acquireDiscoveryRequest());
+    EXPECT_FALSE(this->sut.acquireDiscoveryRequest());
+}
+
+TYPED_TEST(BasePort_test, RequestDiscoveryWithoutNotificationDataSetsDiscoveryRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "23268cfe-36e9-4150-a97c-5a4cf636c3d4");
+    this->sut.acquireDiscoveryRequest();
+
+    this->sut.requestDiscovery();
+
+    EXPECT_TRUE(this->sut.acquireDiscoveryRequest());
+}
+
+TYPED_TEST(BasePort_test, RequestDiscoveryNotifiesDiscoveryConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "264ffbbf-3f09-4bb5-9a73-7432091da8ef");
+    DiscoveryNotificationData discoveryNotificationData;
+    discoveryNotificationData.m_portDiscoveryRequested.store(false);
+    ConditionListener listener(discoveryNotificationData.m_conditionVariableData);
+    this->sutData->m_discoveryNotificationDataPtr = &discoveryNotificationData;
+    this->sut.acquireDiscoveryRequest();
+
+    this->sut.requestDiscovery();
+
+    EXPECT_TRUE(this->sut.acquireDiscoveryRequest());
+    EXPECT_TRUE(discoveryNotificationData.m_portDiscoveryRequested.load());
+    ASSERT_TRUE(listener.wasNotified());
+    auto notifications = listener.timedWait(iox::units::Duration::fromMilliseconds(0U));
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(DiscoveryNotificationData::PORT_NOTIFICATION_INDEX));
+}
+
+TYPED_TEST(BasePort_test, DestroyRequestsDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "010c8416-1228-4433-b6c0-b5af4f10d513");
+    DiscoveryNotificationData discoveryNotificationData;
+    discoveryNotificationData.m_portDiscoveryRequested.store(false);
+    this->sutData->m_discoveryNotificationDataPtr = &discoveryNotificationData;
+    this->sut.acquireDiscoveryRequest();
+
+    this->sut.destroy();
+
+    EXPECT_TRUE(this->sut.toBeDestroyed());
+    EXPECT_TRUE(this->sut.acquireDiscoveryRequest());
+    EXPECT_TRUE(discoveryNotificationData.m_portDiscoveryRequested.load());
+}
+
 } // namespace
@@ -0,0 +1,129 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class ChunkCache_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        sut.init(m_indices, CAPACITY);
+    }
+
+    static constexpr uint32_t CAPACITY{4U};
+    static constexpr uint32_t PID{1234U};
+    static constexpr uint32_t THREAD_ID{42U};
+
+    uint32_t m_indices[CAPACITY]{};
+    ChunkCache sut;
+};
+
+TEST_F(ChunkCache_test, InitializedCacheIsEmptyAndHasNoOwner)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cbf54df6-7599-4176-ac43-bb374dc5841c");
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(sut.capacity(), Eq(CAPACITY));
+    EXPECT_THAT(sut.getOwner(), Eq(ChunkCache::NO_OWNER));
+}
+
+TEST_F(ChunkCache_test, OwnerContainsThePid)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fc3d29cd-95c4-4bf8-90e4-f8be3b3fd7ad");
+    const auto owner = ChunkCache::createOwner(PID, THREAD_ID);
+
+    EXPECT_THAT(owner, Ne(ChunkCache::NO_OWNER));
+    EXPECT_THAT(ChunkCache::pidOf(owner), Eq(PID));
+    EXPECT_THAT(ChunkCache::createOwner(PID, THREAD_ID + 1U), Ne(owner));
+}
+
+TEST_F(ChunkCache_test, ClaimingAnUnusedCacheSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3028ced1-1310-480e-b749-fc879c78534c");
+    const auto owner = ChunkCache::createOwner(PID, THREAD_ID);
+
+    EXPECT_TRUE(sut.tryClaim(owner));
+    EXPECT_THAT(sut.getOwner(), Eq(owner));
+}
+
+TEST_F(ChunkCache_test, ClaimingAnAlreadyClaimedCacheFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e225ea33-14d6-4482-9148-1a70aa1fc3df");
+    const auto owner = ChunkCache::createOwner(PID, THREAD_ID);
+    const auto otherOwner = ChunkCache::createOwner(PID, THREAD_ID + 1U);
+    ASSERT_TRUE(sut.tryClaim(owner));
+
+    EXPECT_FALSE(sut.tryClaim(otherOwner));
+    EXPECT_THAT(sut.getOwner(), Eq(owner));
+}
+
+TEST_F(ChunkCache_test, ReleasedCacheCanBeClaimedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f25ac1d-f852-4c0b-848f-4853fd33a385");
+    const auto owner = ChunkCache::createOwner(PID, THREAD_ID);
+    const auto otherOwner = ChunkCache::createOwner(PID, THREAD_ID + 1U);
+    ASSERT_TRUE(sut.tryClaim(owner));
+
+    sut.release();
+
+    EXPECT_THAT(sut.getOwner(), Eq(ChunkCache::NO_OWNER));
+    EXPECT_TRUE(sut.tryClaim(otherOwner));
+}
+
+TEST_F(ChunkCache_test, PopReturnsTheIndicesInReverseOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aef8d66e-168f-436c-a0db-7a5ef3047771");
+    constexpr uint32_t FIRST_INDEX{13U};
+    constexpr uint32_t SECOND_INDEX{37U};
+    ASSERT_TRUE(sut.push(FIRST_INDEX));
+    ASSERT_TRUE(sut.push(SECOND_INDEX));
+    EXPECT_THAT(sut.size(), Eq(2U));
+
+    uint32_t index{0U};
+    ASSERT_TRUE(sut.pop(index));
+    EXPECT_THAT(index, Eq(SECOND_INDEX));
+    ASSERT_TRUE(sut.pop(index));
+    EXPECT_THAT(index, Eq(FIRST_INDEX));
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(ChunkCache_test, PopFromEmptyCacheFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a66b2cde-a420-4e74-bc7e-3ec93937eb98");
+    uint32_t index{0U};
+    EXPECT_FALSE(sut.pop(index));
+}
+
+TEST_F(ChunkCache_test, PushToFullCacheFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b099d73d-a0a3-4f78-b3d3-6df68b439f9f");
+    for (uint32_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.push(i));
+    }
+
+    EXPECT_FALSE(sut.push(CAPACITY));
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+}
+
+} // namespace
@@ -103,6 +103,15 @@ TEST_F(MePooConfig_Test, GetMemoryConfigMethodReturnsTheMemPoolConfigContainerWi
     EXPECT_THAT((mempoolconfptr[0].data()->m_size), Eq(SIZE));
 }
 
+TEST_F(MePooConfig_Test, DefaultSizeClassLookupIsBinarySearchAndDefaultOverflowPolicyIsFail)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3631cf7e-7807-4aa0-a867-34ef204fe2de");
+    MePooConfig sut;
+
+    EXPECT_THAT(sut.m_sizeClassLookup, Eq(iox::mepoo::SizeClassLookup::BINARY_SEARCH));
+    EXPECT_THAT(sut.m_overflowPolicy, Eq(iox::mepoo::MemPoolOverflowPolicy::FAIL));
+}
+
 TEST_F(MePooConfig_Test, OptimizeMethodCombinesTwoMempoolWithSameSizeAndDoublesTheChunkCountInTheMemPoolConfigContainer)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b39e5bc5-4352-4427-be72-deeed45d937d");
@@ -118,6 +127,22 @@ TEST_F(MePooConfig_Test, OptimizeMethodCombinesTwoMempoolWithSameSizeAndDoublesT
     EXPECT_THAT(sut.m_mempoolConfig[0].m_chunkCount, Eq(CHUNK_COUNT * 2U));
 }
 
+TEST_F(MePooConfig_Test, OptimizeMethodCombinesTwoMempoolWithSameSizeAndKeepsTheLargerChunkCacheDepth)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a5354f66-9053-4dc1-9ae1-f7492dbe38c8");
+    MePooConfig sut;
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint64_t SIZE{100U};
+    constexpr uint32_t CHUNK_CACHE_DEPTH{16U};
+    sut.addMemPool({SIZE, CHUNK_COUNT});
+    sut.addMemPool({SIZE, CHUNK_COUNT, CHUNK_CACHE_DEPTH});
+
+    sut.optimize();
+
+    ASSERT_THAT(sut.m_mempoolConfig.size(), Eq(1U));
+    EXPECT_THAT(sut.m_mempoolConfig[0].m_chunkCacheDepth, Eq(CHUNK_CACHE_DEPTH));
+}
+
 TEST_F(MePooConfig_Test, OptimizeMethodRemovesTheMempoolWithSizeZeroInTheMemPoolConfigContainer)
 {
     ::testing::Test::RecordProperty("TEST_ID", "56209c3e-8b69-45cd-8ea5-ef347152ff7c");
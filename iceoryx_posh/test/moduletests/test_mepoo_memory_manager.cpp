@@ -377,6 +377,141 @@ TEST_F(MemoryManager_test, emptyMemPoolDoesNotResultInAcquiringChunksFromOtherMe
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
 }
 
+TEST_F(MemoryManager_test, emptyMemPoolResultsInAcquiringChunksFromLargerMemPoolsWithOverflowPolicy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "62a9a9e5-748b-4b7c-9c59-e9a1352352cd");
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.m_overflowPolicy = iox::mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+    sut->getChunk(chunkSettings_64)
+        .and_then([&](auto& chunk) {
+            EXPECT_THAT(chunk.getChunkHeader()->chunkSize(), Eq(CHUNK_SIZE_128 + sizeof(ChunkHeader)));
+        })
+        .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkFailsWithOverflowPolicyWhenAllLargerMemPoolsAreEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f9df70e0-31b0-4c50-94a7-a1666ebeb1ec");
+    constexpr uint32_t CHUNK_COUNT{10};
+
+    mempoolconf.m_overflowPolicy = iox::mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(3U * CHUNK_COUNT, chunkSettings_32);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_32)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(CHUNK_COUNT));
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, getChunkUpdatesStatisticsOfTheMemPoolWhichProvidesTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "37010864-5188-4936-a087-d462bb38765d");
+    constexpr uint32_t CHUNK_COUNT{10};
+
+    mempoolconf.m_overflowPolicy = iox::mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT + 1U, chunkSettings_64);
+
+    auto sumOfChunkFillHistogram = [](const iox::mepoo::MemPoolInfo& info) {
+        uint64_t sum{0U};
+        for (const auto count : info.m_chunkFillHistogram)
+        {
+            sum += count;
+        }
+        return sum;
+    };
+
+    const auto info64 = sut->collectMemPoolInfo(1);
+    EXPECT_THAT(info64.m_allocationFailures, Eq(1U));
+    EXPECT_THAT(info64.m_maxUsedChunksInInterval, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sumOfChunkFillHistogram(info64), Eq(CHUNK_COUNT));
+    EXPECT_THAT(info64.m_chunkFillHistogram[iox::NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS - 1U], Eq(CHUNK_COUNT));
+
+    const auto info128 = sut->collectMemPoolInfo(2);
+    EXPECT_THAT(info128.m_allocationFailures, Eq(0U));
+    EXPECT_THAT(info128.m_maxUsedChunksInInterval, Eq(1U));
+    EXPECT_THAT(sumOfChunkFillHistogram(info128), Eq(1U));
+
+    EXPECT_THAT(sumOfChunkFillHistogram(sut->collectMemPoolInfo(0)), Eq(0U));
+}
+
+class MemoryManagerSizeClassLookup_test : public MemoryManager_test,
+                                          public WithParamInterface<iox::mepoo::SizeClassLookup>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(LinearAndBinarySearch,
+                         MemoryManagerSizeClassLookup_test,
+                         Values(iox::mepoo::SizeClassLookup::LINEAR_SEARCH,
+                                iox::mepoo::SizeClassLookup::BINARY_SEARCH));
+
+TEST_P(MemoryManagerSizeClassLookup_test, getChunkUsesTheSmallestFittingMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b945ec7f-7384-4baa-aa3b-fa74a64b2ef9");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint64_t NUMBER_OF_MEMPOOLS{iox::MAX_NUMBER_OF_MEMPOOLS};
+    constexpr uint64_t CHUNK_SIZE_STEP{32U};
+
+    mempoolconf.m_sizeClassLookup = GetParam();
+    for (uint64_t i = 1U; i <= NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({i * CHUNK_SIZE_STEP, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint64_t userPayloadSize = 1U; userPayloadSize <= NUMBER_OF_MEMPOOLS * CHUNK_SIZE_STEP; userPayloadSize += 7U)
+    {
+        auto chunkSettings = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+        const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+        sut->getChunk(chunkSettings)
+            .and_then([&](auto& chunk) {
+                const auto chunkSize = chunk.getChunkHeader()->chunkSize();
+                EXPECT_THAT(chunkSize, Ge(requiredChunkSize));
+                EXPECT_THAT(chunkSize, Lt(requiredChunkSize + CHUNK_SIZE_STEP));
+            })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+
+    auto tooLargeChunkSettings =
+        ChunkSettings::create(NUMBER_OF_MEMPOOLS * CHUNK_SIZE_STEP + 1U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+            .value();
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE};
+    sut->getChunk(tooLargeChunkSettings)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE);
+}
+
 TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0eddc5b5-e28f-43df-9da7-2c12014284a5");
@@ -435,6 +570,53 @@ TEST_F(MemoryManager_test, getChunkWithUserPayloadSizeZeroShouldNotFail)
     });
 }
 
+TEST_F(MemoryManager_test, freeChunkMultiMemPoolWithChunkCacheFullToEmptyToFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "77761e6f-3ea0-4a4d-af8e-cd9eab98750d");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint32_t CHUNK_CACHE_DEPTH{16U};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, CHUNK_CACHE_DEPTH});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    // chunks are freed when they go out of scope
+    {
+        auto chunkStore_32 = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+        auto chunkStore_64 = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+        EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+        EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_minFreeChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+
+    auto chunkStore_32 = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    auto chunkStore_64 = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, requiredManagementMemorySizeIncludesChunkCaches)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd6aa1cf-9898-463b-a16a-7d9755384107");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint32_t CHUNK_CACHE_DEPTH{16U};
+
+    iox::mepoo::MePooConfig mempoolconfWithChunkCache;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconfWithChunkCache.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, CHUNK_CACHE_DEPTH});
+
+    const auto chunkCacheMemorySize = iox::mepoo::MemPool::requiredChunkCacheMemorySize(CHUNK_CACHE_DEPTH);
+    EXPECT_THAT(chunkCacheMemorySize, Gt(0U));
+    // the mempool and the chunk management pool have chunk caches
+    EXPECT_THAT(iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolconfWithChunkCache),
+                Ge(iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolconf) + 2U * chunkCacheMemorySize));
+}
+
 TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
 {
     ::testing::Test::RecordProperty("TEST_ID", "be653b65-a2d1-42eb-98b5-d161c6ba7c08");
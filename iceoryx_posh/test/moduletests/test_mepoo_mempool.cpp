@@ -23,8 +23,12 @@
 #include "iox/detail/system_configuration.hpp"
 
 #include "iceoryx_hoofs/testing/fatal_failure.hpp"
+#include "iceoryx_platform/unistd.hpp"
 #include "test.hpp"
 
+#include <set>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -300,6 +304,112 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, GetMinFreeIsNotIncreasedByFreeChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "28c83f8d-c695-4e67-92d2-328bc1ec89b1");
+    auto* chunk1 = sut.getChunk();
+    auto* chunk2 = sut.getChunk();
+    sut.freeChunk(chunk1);
+    sut.freeChunk(chunk2);
+
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - 2U));
+}
+
+TEST_F(MemPool_test, MinFreeAndMaxUsedAreExactWithConcurrentGetChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1556b17c-e2e4-4e64-bdcc-650e7258ec55");
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    constexpr uint32_t CHUNKS_PER_THREAD{NUMBER_OF_CHUNKS / NUMBER_OF_THREADS};
+
+    iox::concurrent::Atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&] {
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+            for (uint32_t i = 0U; i < CHUNKS_PER_THREAD; ++i)
+            {
+                EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+            }
+        });
+    }
+    start.store(true);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(0U));
+    EXPECT_THAT(sut.getMaxUsedChunksInInterval(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(MemPool_test, CollectInfoStartsNewIntervalForMaxUsedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b084698c-ae9e-4a4e-b269-79f2b57a0f80");
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < 5U; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+    }
+    for (uint32_t i = 0U; i < 3U; ++i)
+    {
+        sut.freeChunk(chunks.back());
+        chunks.pop_back();
+    }
+
+    auto info = sut.collectInfo();
+    EXPECT_THAT(info.m_usedChunks, Eq(2U));
+    EXPECT_THAT(info.m_maxUsedChunksInInterval, Eq(5U));
+    EXPECT_THAT(info.m_minFreeChunks, Eq(NUMBER_OF_CHUNKS - 5U));
+
+    info = sut.collectInfo();
+    EXPECT_THAT(info.m_maxUsedChunksInInterval, Eq(2U));
+    EXPECT_THAT(info.m_minFreeChunks, Eq(NUMBER_OF_CHUNKS - 5U));
+
+    chunks.push_back(sut.getChunk());
+    EXPECT_THAT(sut.collectInfo().m_maxUsedChunksInInterval, Eq(3U));
+}
+
+TEST_F(MemPool_test, GetChunkWithoutFreeChunksIncreasesAllocationFailures)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "72fd2e91-053b-4389-aeb7-2acd4788bac1");
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.getChunk();
+    }
+    EXPECT_THAT(sut.getAllocationFailures(), Eq(0U));
+
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+
+    EXPECT_THAT(sut.getAllocationFailures(), Eq(2U));
+    EXPECT_THAT(sut.getInfo().m_allocationFailures, Eq(2U));
+}
+
+TEST_F(MemPool_test, RecordChunkFillAddsAllocationToTheCorrespondingBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "620d7ddf-9a71-4420-9eef-1bcf6cd16695");
+    constexpr uint64_t BUCKET_SIZE{CHUNK_SIZE / iox::NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS};
+    sut.recordChunkFill(0U);
+    sut.recordChunkFill(BUCKET_SIZE - 1U);
+    sut.recordChunkFill(BUCKET_SIZE);
+    sut.recordChunkFill(CHUNK_SIZE - 1U);
+    sut.recordChunkFill(CHUNK_SIZE);
+
+    const auto info = sut.getInfo();
+    EXPECT_THAT(info.m_chunkFillHistogram[0U], Eq(2U));
+    EXPECT_THAT(info.m_chunkFillHistogram[1U], Eq(1U));
+    for (uint32_t i = 2U; i + 1U < iox::NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS; ++i)
+    {
+        EXPECT_THAT(info.m_chunkFillHistogram[i], Eq(0U));
+    }
+    EXPECT_THAT(info.m_chunkFillHistogram[iox::NUMBER_OF_CHUNK_FILL_HISTOGRAM_BUCKETS - 1U], Eq(2U));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7704246e-42b5-46fd-8827-ebac200390e1");
@@ -316,4 +426,191 @@ TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsNotPowerOf32)
                              iox::PoshError::MEPOO__MEMPOOL_CHUNKSIZE_MUST_BE_MULTIPLE_OF_CHUNK_MEMORY_ALIGNMENT);
 }
 
+class MemPoolWithChunkCache_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_CHUNKS{100U};
+    static constexpr uint64_t CHUNK_SIZE{64U};
+    static constexpr uint32_t CHUNK_CACHE_DEPTH{8U};
+    static constexpr uint64_t MANAGEMENT_MEMORY_SIZE{
+        iox::mepoo::MemPool::freeList_t::requiredIndexMemorySize(NUMBER_OF_CHUNKS) + 10000U};
+
+    MemPoolWithChunkCache_test()
+        : allocator(m_rawMemory, NUMBER_OF_CHUNKS * CHUNK_SIZE + MANAGEMENT_MEMORY_SIZE)
+        , sut(CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator, CHUNK_CACHE_DEPTH)
+    {
+    }
+
+    /// @brief acquires chunks until the mempool is empty from a new thread and releases them afterwards
+    uint32_t numberOfChunksAvailableForNewThread()
+    {
+        uint32_t numberOfChunks{0U};
+        std::thread t([&] {
+            std::vector<void*> chunks;
+            for (void* chunk = sut.getChunk(); chunk != nullptr; chunk = sut.getChunk())
+            {
+                chunks.push_back(chunk);
+            }
+            numberOfChunks = static_cast<uint32_t>(chunks.size());
+            for (auto* chunk : chunks)
+            {
+                sut.freeChunk(chunk);
+            }
+        });
+        t.join();
+        return numberOfChunks;
+    }
+
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t
+        m_rawMemory[NUMBER_OF_CHUNKS * CHUNK_SIZE + MANAGEMENT_MEMORY_SIZE];
+    iox::BumpAllocator allocator;
+
+    MemPool sut;
+};
+
+TEST_F(MemPoolWithChunkCache_test, ChunkCacheDepthIsSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2e632f5-c36b-43a1-b73c-05fcf8637e32");
+    EXPECT_THAT(sut.getChunkCacheDepth(), Eq(CHUNK_CACHE_DEPTH));
+}
+
+TEST_F(MemPoolWithChunkCache_test, ChunkCacheDepthIsLimited)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd1d663f-d250-4530-b6ed-157733e99a17");
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) static uint8_t rawMemory[100000U];
+    iox::BumpAllocator largeAllocator(rawMemory, sizeof(rawMemory));
+    MemPool sutWithLargeChunkCache(CHUNK_SIZE, 1U, largeAllocator, largeAllocator, iox::MAX_CHUNK_CACHE_DEPTH + 1U);
+
+    EXPECT_THAT(sutWithLargeChunkCache.getChunkCacheDepth(), Eq(iox::MAX_CHUNK_CACHE_DEPTH));
+}
+
+TEST_F(MemPoolWithChunkCache_test, AllChunksCanBeAcquiredOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6311e797-479b-49da-928f-10f4b80d7dd4");
+    std::set<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto* chunk = sut.getChunk();
+        ASSERT_THAT(chunk, Ne(nullptr));
+        chunks.insert(chunk);
+    }
+
+    EXPECT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+}
+
+TEST_F(MemPoolWithChunkCache_test, CachedChunksAreCountedAsFreeChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "df9cfb91-8a12-4db6-b34e-111e1f5be0e3");
+    constexpr uint32_t NUMBER_OF_ACQUIRED_CHUNKS{3U};
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_ACQUIRED_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+    }
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_ACQUIRED_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_ACQUIRED_CHUNKS));
+
+    for (auto* chunk : chunks)
+    {
+        sut.freeChunk(chunk);
+    }
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_ACQUIRED_CHUNKS));
+}
+
+TEST_F(MemPoolWithChunkCache_test, ReleasedChunkIsReusedByTheSameThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd0eadba-7b8b-42b0-8327-4a845d029050");
+    auto* chunk = sut.getChunk();
+    ASSERT_THAT(chunk, Ne(nullptr));
+    sut.freeChunk(chunk);
+
+    EXPECT_THAT(sut.getChunk(), Eq(chunk));
+}
+
+TEST_F(MemPoolWithChunkCache_test, ReleasingMoreChunksThanTheDepthReturnsThemToTheFreeList)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "23f3639f-4e7f-4ef7-b988-2f1915ea9325");
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+    }
+    for (auto* chunk : chunks)
+    {
+        sut.freeChunk(chunk);
+    }
+
+    EXPECT_THAT(numberOfChunksAvailableForNewThread(), Ge(NUMBER_OF_CHUNKS - CHUNK_CACHE_DEPTH));
+}
+
+TEST_F(MemPoolWithChunkCache_test, ChunkCacheIsFlushedWhenTheThreadTerminates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a70d25c6-0683-4f59-9c38-ee8e4bfe138c");
+    std::thread t([&] { sut.freeChunk(sut.getChunk()); });
+    t.join();
+
+    EXPECT_THAT(numberOfChunksAvailableForNewThread(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(MemPoolWithChunkCache_test, ChunkCachesOfProcessCanBeReclaimed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8c8d8fad-3f9f-4e1d-8d60-6e621ea3671d");
+    std::thread t([&] {
+        sut.freeChunk(sut.getChunk());
+        // destroying another mempool invalidates the mapping of the chunk caches of the thread, therefore the chunk
+        // cache of the thread is not flushed like it happens when a process terminates abnormally
+        alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t rawMemory[1000U];
+        iox::BumpAllocator otherAllocator(rawMemory, sizeof(rawMemory));
+        MemPool otherMemPool(CHUNK_SIZE, 1U, otherAllocator, otherAllocator);
+    });
+    t.join();
+    ASSERT_THAT(numberOfChunksAvailableForNewThread(), Lt(NUMBER_OF_CHUNKS));
+
+    sut.reclaimChunkCaches(static_cast<uint32_t>(getpid()));
+
+    EXPECT_THAT(numberOfChunksAvailableForNewThread(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(MemPoolWithChunkCache_test, ConcurrentGetAndFreeChunkKeepsAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e94bc23-47be-4590-ae30-eae177b5c22c");
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    constexpr uint32_t NUMBER_OF_ITERATIONS{1000U};
+    constexpr uint32_t NUMBER_OF_CHUNKS_PER_ITERATION{5U};
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&] {
+            void* chunks[NUMBER_OF_CHUNKS_PER_ITERATION]{};
+            for (uint32_t iteration = 0U; iteration < NUMBER_OF_ITERATIONS; ++iteration)
+            {
+                for (auto& chunk : chunks)
+                {
+                    chunk = sut.getChunk();
+                }
+                for (auto* chunk : chunks)
+                {
+                    if (chunk != nullptr)
+                    {
+                        sut.freeChunk(chunk);
+                    }
+                }
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(numberOfChunksAvailableForNewThread(), Eq(NUMBER_OF_CHUNKS));
+}
+
 } // namespace
@@ -109,6 +109,14 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::access_rights, permissions, iox::perms::none)
 
+        IOX_BUILDER_PARAMETER(bool, prefault, false)
+
+        IOX_BUILDER_PARAMETER(uint32_t, numberOfZeroingThreads, 1U)
+
+        IOX_BUILDER_PARAMETER(bool, transparentHugePages, false)
+
+        IOX_BUILDER_PARAMETER(bool, lockMemory, false)
+
       public:
         iox::expected<SharedMemoryObject_MOCK, PosixSharedMemoryObjectError> create() noexcept
         {
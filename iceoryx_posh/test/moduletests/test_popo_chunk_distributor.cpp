@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
@@ -122,6 +123,12 @@ class ChunkDistributor_test : public Test
         return std::make_shared<ChunkDistributorData_t>(policy, HISTORY_SIZE);
     }
 
+    std::shared_ptr<ChunkDistributorData_t> getLockFreeChunkDistributorData(
+        const ConsumerTooSlowPolicy policy = ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+    {
+        return std::make_shared<ChunkDistributorData_t>(policy, 0U, QueueDeliveryMode::LOCK_FREE_SNAPSHOT);
+    }
+
     static constexpr std::chrono::milliseconds BLOCKING_DURATION{100};
 
     static constexpr iox::units::Duration DEADLOCK_TIMEOUT{2_s};
@@ -822,4 +829,428 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliveryUnblocksWhenBlockingQueueIsRemoved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "14298cb6-d7e0-4821-8310-8db91282fd81");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    Barrier isThreadStarted(1U);
+    iox::concurrent::Atomic<bool> wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    // the removal returns only when the producer does not wait on the queue anymore
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(0U));
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    EXPECT_THAT(queue.size(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockedProducerIsDeregisteredAfterDelivery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "789244dd-2c9d-48b7-8aa6-66e5063329a7");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    Barrier isThreadStarted(1U);
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_TRUE(queue.tryPop().has_value());
+    t1.join();
+
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(0U));
+    EXPECT_THAT(sutData->m_numberOfProducersWaitingForSpace.load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockedDeliveryIsRecordedInLatencyHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "852e1f8e-3d4a-4ec6-a479-8c9d3b0fb954");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+    EXPECT_THAT(sutData->m_blockedDeliveryLatencyHistogram.totalCount(), Eq(0U));
+
+    Barrier isThreadStarted(1U);
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_TRUE(queue.tryPop().has_value());
+    t1.join();
+
+    const auto minimumBucket =
+        LatencyHistogram::bucketIndex(iox::units::Duration::fromMilliseconds(this->BLOCKING_DURATION.count() / 2));
+    uint64_t numberOfLongBlockings{0U};
+    for (uint32_t i = minimumBucket; i < LatencyHistogram::NUMBER_OF_BUCKETS; ++i)
+    {
+        numberOfLongBlockings += sutData->m_blockedDeliveryLatencyHistogram.count(i);
+    }
+    EXPECT_THAT(sutData->m_blockedDeliveryLatencyHistogram.totalCount(), Eq(1U));
+    EXPECT_THAT(numberOfLongBlockings, Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockedDeliveryToQueueIsRecordedInLatencyHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d482416-3853-4fee-8b51-4506d65ce69f");
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(1U)).has_error());
+    EXPECT_THAT(sutData->m_blockedDeliveryLatencyHistogram.totalCount(), Eq(0U));
+
+    Barrier isThreadStarted(1U);
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        EXPECT_FALSE(
+            sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(2U)).has_error());
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_TRUE(queue.tryPop().has_value());
+    t1.join();
+
+    EXPECT_THAT(sutData->m_blockedDeliveryLatencyHistogram.totalCount(), Eq(1U));
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(0U));
+    EXPECT_THAT(sutData->m_numberOfProducersWaitingForSpace.load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, LockFreeDeliveryToAllStoredQueuesWithMultipleQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25f26364-3b34-4e4a-ad6b-06cd6d892b26");
+    auto sutData = this->getLockFreeChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 10U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    auto chunk = this->allocateChunk(24451);
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(chunk);
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_QUEUES));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(24451u));
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(0u));
+}
+
+TYPED_TEST(ChunkDistributor_test, LockFreeDeliveryDoesNotDeliverToRemovedQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "45e07908-dd55-4081-891e-6594f8f8d6a0");
+    auto sutData = this->getLockFreeChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto removedQueueData = this->getChunkQueueData();
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(removedQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(removedQueueData.get()).has_error());
+
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(7331));
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> removedQueue(removedQueueData.get());
+    EXPECT_THAT(removedQueue.size(), Eq(0u));
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_THAT(queue.size(), Eq(1u));
+
+    sut.removeAllQueues();
+    numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(7332));
+    EXPECT_THAT(numberOfDeliveries, Eq(0U));
+    EXPECT_THAT(queue.size(), Eq(1u));
+}
+
+TYPED_TEST(ChunkDistributor_test, LockFreeDeliveryDoesNotTakeTheLock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "78b165e6-eb3a-4b6c-bb3c-2587e4fa825e");
+    auto sutData = this->getLockFreeChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sutData->lock();
+    uint64_t numberOfDeliveries{0U};
+    std::thread t1([&] { numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(1337)); });
+    t1.join();
+    sutData->unlock();
+
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(1337u));
+}
+
+TYPED_TEST(ChunkDistributor_test, LockFreeDeliveryToSingleQueueBlocksWhenOptionsAreSetToBlocking)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7801d1e8-30d8-41d0-ba85-bde102d5ae62");
+    auto sutData = this->getLockFreeChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    Barrier isThreadStarted(1U);
+    iox::concurrent::Atomic<bool> wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+
+    maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(152U));
+}
+
+TYPED_TEST(ChunkDistributor_test, LockFreeDeliveryUnblocksWhenBlockingQueueIsRemoved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39b86b3e-e01b-47f3-a097-2dbaf4903977");
+    auto sutData = this->getLockFreeChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    Barrier isThreadStarted(1U);
+    iox::concurrent::Atomic<bool> wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    EXPECT_THAT(queue.size(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46df3610-e12f-409b-862d-e5399e67cfd3");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 4U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    constexpr uint64_t BATCH_SIZE = 3U;
+    std::vector<SharedChunk> chunks{this->allocateChunk(1U), this->allocateChunk(2U), this->allocateChunk(3U)};
+    auto numberOfDeliveries = sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks));
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_QUEUES * BATCH_SIZE));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        for (uint32_t expectedValue = 1U; expectedValue <= BATCH_SIZE; ++expectedValue)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+        }
+        EXPECT_THAT(queue.empty(), Eq(true));
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(BATCH_SIZE));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverEmptyBatchToAllStoredQueuesDeliversNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd9cf707-16ac-4cef-99c4-db8abbb6a761");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    std::vector<SharedChunk> chunks;
+    EXPECT_THAT(sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks)), Eq(0U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_THAT(queue.empty(), Eq(true));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesNotifiesEveryQueueOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "12d5d701-0d52-4bd8-a0a0-f35fc7fd3cf6");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ConditionVariableData condVar("Batch");
+    queue.setConditionVariable(condVar, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    std::vector<SharedChunk> chunks{this->allocateChunk(1U), this->allocateChunk(2U), this->allocateChunk(3U)};
+    sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks));
+
+    auto wasPosted = condVar.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_THAT(wasPosted.value(), Eq(true));
+    wasPosted = condVar.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_THAT(wasPosted.value(), Eq(false));
+    EXPECT_THAT(queue.size(), Eq(chunks.size()));
+}
+
+TYPED_TEST(ChunkDistributor_test, LockFreeDeliveryOfBatchDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f493b578-9f0f-427b-9510-fa9e77bf1e6f");
+    auto sutData = this->getLockFreeChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    std::vector<SharedChunk> chunks{this->allocateChunk(11U), this->allocateChunk(12U)};
+    EXPECT_THAT(sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks)), Eq(chunks.size()));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    for (uint32_t expectedValue : {11U, 12U})
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToFullBlockingQueueKeepsTheOrderOfTheBatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cc4430b7-df32-4fa4-a22e-5e0d5c815f22");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    std::vector<SharedChunk> chunks{this->allocateChunk(21U), this->allocateChunk(22U), this->allocateChunk(23U)};
+    Barrier isThreadStarted(1U);
+    iox::concurrent::Atomic<bool> wasBatchDelivered{false};
+    uint64_t numberOfDeliveries{0U};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        numberOfDeliveries = sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks));
+        wasBatchDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    for (uint32_t expectedValue : {21U, 22U})
+    {
+        std::this_thread::sleep_for(this->BLOCKING_DURATION);
+        EXPECT_THAT(wasBatchDelivered.load(), Eq(false));
+
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+    }
+
+    t1.join(); // join needs to be before the load to ensure the wasBatchDelivered store happens before the read
+    EXPECT_THAT(wasBatchDelivered.load(), Eq(true));
+    EXPECT_THAT(numberOfDeliveries, Eq(chunks.size()));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(23U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(chunks.size()));
+}
+
 } // namespace
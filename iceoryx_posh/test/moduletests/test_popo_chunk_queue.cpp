@@ -197,6 +197,53 @@ TYPED_TEST(ChunkQueue_test, PopChunkWithIncompatibleChunkHeaderCallsErrorHandler
     IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION);
 }
 
+TYPED_TEST(ChunkQueue_test, TryPopBatchReturnsPushedChunksInTheSameOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5474d26b-35d8-4d4e-b319-23df64d64d8b");
+    constexpr int32_t NUMBER_CHUNKS{5};
+    for (int i = 0; i < NUMBER_CHUNKS; ++i)
+    {
+        auto chunk = this->allocateChunk();
+        *reinterpret_cast<int32_t*>(chunk.getUserPayload()) = i;
+        this->m_pusher.push(chunk);
+    }
+
+    SharedChunk chunks[NUMBER_CHUNKS + 2];
+    ASSERT_THAT(this->m_popper.tryPopBatch(iox::span<SharedChunk>(chunks)), Eq(NUMBER_CHUNKS));
+    for (int i = 0; i < NUMBER_CHUNKS; ++i)
+    {
+        EXPECT_THAT(*reinterpret_cast<int32_t*>(chunks[i].getUserPayload()), Eq(i));
+    }
+    EXPECT_THAT(this->m_popper.empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, TryPopBatchOnEmptyQueueReturnsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a0dfb95d-68b1-48bf-ac4e-5d7b0e451a70");
+    SharedChunk chunks[2];
+    EXPECT_THAT(this->m_popper.tryPopBatch(iox::span<SharedChunk>(chunks)), Eq(0U));
+}
+
+TYPED_TEST(ChunkQueue_test, TryPopBatchDropsChunkWithIncompatibleChunkHeaderAndCallsErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b3023abf-084c-4aec-bc41-783bd76891f1");
+    auto validChunk = this->allocateChunk();
+    auto invalidChunk = this->allocateChunk();
+    // this is currently the only possibility to test an invalid CHUNK_HEADER_VERSION
+    auto chunkHeaderAddress = reinterpret_cast<uint64_t>(invalidChunk.getChunkHeader());
+    auto chunkHeaderVersionAddress = chunkHeaderAddress + sizeof(uint32_t);
+    auto chunkHeaderVersionPointer = reinterpret_cast<uint8_t*>(chunkHeaderVersionAddress);
+    *chunkHeaderVersionPointer = std::numeric_limits<uint8_t>::max();
+
+    this->m_pusher.push(invalidChunk);
+    this->m_pusher.push(validChunk);
+
+    SharedChunk chunks[2];
+    ASSERT_THAT(this->m_popper.tryPopBatch(iox::span<SharedChunk>(chunks)), Eq(1U));
+    EXPECT_THAT(chunks[0], Eq(validChunk));
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION);
+}
+
 TYPED_TEST(ChunkQueue_test, ClearOnEmpty)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9923de92-5c69-4b79-9f3b-793e790d07f3");
@@ -238,6 +285,44 @@ TYPED_TEST(ChunkQueue_test, PushAndNotifyConditionVariable)
     EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true)); // shouldn't trigger a second time
 }
 
+TYPED_TEST(ChunkQueue_test, PushWithoutNotificationDoesNotNotifyConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a3b0b4b-6670-47ac-9956-5e8f30fa1ecd");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    auto chunk = this->allocateChunk();
+    EXPECT_THAT(this->m_pusher.pushWithoutNotification(chunk), Eq(true));
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+    EXPECT_THAT(this->m_popper.size(), Eq(1U));
+}
+
+TYPED_TEST(ChunkQueue_test, NotifyAfterMultiplePushesWithoutNotificationNotifiesConditionVariableOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "037d6d11-1fa7-48ba-a156-cb8d14545a7c");
+    ConditionVariableData condVar("Horscht");
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        this->m_pusher.pushWithoutNotification(this->allocateChunk());
+    }
+    this->m_pusher.notify();
+
+    auto wasPosted = condVar.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_THAT(wasPosted.value(), Eq(true));
+    wasPosted = condVar.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_THAT(wasPosted.value(), Eq(false));
+    EXPECT_THAT(this->m_popper.size(), Eq(NUMBER_OF_CHUNKS));
+}
+
 TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "3e55346f-62e1-44bb-bfe8-cef929935edf");
@@ -259,6 +344,83 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, OnlyBlockingQueueHasSpaceAvailableConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4cd1ae44-cc3e-4c9e-86bd-32ad44dff7c9");
+    typename TestFixture::ChunkQueueData_t blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER, this->m_variantQueueType};
+
+    EXPECT_THAT(this->m_chunkData.m_spaceAvailableConditionVariableData.has_value(), Eq(false));
+    EXPECT_THAT(blockingChunkData.m_spaceAvailableConditionVariableData.has_value(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, PopNotifiesSpaceAvailableWhenProducerIsBlocked)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ce72603-c0f1-4f63-98c8-116465bc7618");
+    typename TestFixture::ChunkQueueData_t blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER, this->m_variantQueueType};
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> popper{&blockingChunkData};
+    ChunkQueuePusher<typename TestFixture::ChunkQueueData_t> pusher{&blockingChunkData};
+    ConditionListener spaceAvailableListener{*blockingChunkData.m_spaceAvailableConditionVariableData};
+
+    EXPECT_TRUE(pusher.push(this->allocateChunk()));
+    blockingChunkData.m_numberOfBlockedProducers.store(1U);
+
+    EXPECT_THAT(popper.tryPop().has_value(), Eq(true));
+
+    EXPECT_THAT(spaceAvailableListener.timedWait(1_ns).empty(), Eq(false));
+    EXPECT_THAT(spaceAvailableListener.timedWait(1_ns).empty(), Eq(true)); // shouldn't trigger a second time
+}
+
+TYPED_TEST(ChunkQueue_test, TryPopBatchNotifiesSpaceAvailableOnceWhenProducerIsBlocked)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4cee67a-2271-40b7-9cbd-a0f1569d1f7e");
+    typename TestFixture::ChunkQueueData_t blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER, this->m_variantQueueType};
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> popper{&blockingChunkData};
+    ChunkQueuePusher<typename TestFixture::ChunkQueueData_t> pusher{&blockingChunkData};
+    ConditionListener spaceAvailableListener{*blockingChunkData.m_spaceAvailableConditionVariableData};
+
+    EXPECT_TRUE(pusher.push(this->allocateChunk()));
+    EXPECT_TRUE(pusher.push(this->allocateChunk()));
+    EXPECT_TRUE(pusher.push(this->allocateChunk()));
+    blockingChunkData.m_numberOfBlockedProducers.store(1U);
+
+    SharedChunk chunks[3];
+    EXPECT_THAT(popper.tryPopBatch(iox::span<SharedChunk>(chunks)), Eq(3U));
+
+    EXPECT_THAT(spaceAvailableListener.timedWait(1_ns).empty(), Eq(false));
+    EXPECT_THAT(spaceAvailableListener.timedWait(1_ns).empty(), Eq(true)); // shouldn't trigger a second time
+}
+
+TYPED_TEST(ChunkQueue_test, PopDoesNotNotifySpaceAvailableWithoutBlockedProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "79b25c68-8131-4dfa-8f7c-5446fca5db86");
+    typename TestFixture::ChunkQueueData_t blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER, this->m_variantQueueType};
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> popper{&blockingChunkData};
+    ChunkQueuePusher<typename TestFixture::ChunkQueueData_t> pusher{&blockingChunkData};
+    ConditionListener spaceAvailableListener{*blockingChunkData.m_spaceAvailableConditionVariableData};
+
+    EXPECT_TRUE(pusher.push(this->allocateChunk()));
+
+    EXPECT_THAT(popper.tryPop().has_value(), Eq(true));
+
+    EXPECT_THAT(spaceAvailableListener.timedWait(1_ns).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, ClearNotifiesSpaceAvailableWhenProducerIsBlocked)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f75fc526-f888-42d1-9103-d367bde69971");
+    typename TestFixture::ChunkQueueData_t blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER, this->m_variantQueueType};
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> popper{&blockingChunkData};
+    ChunkQueuePusher<typename TestFixture::ChunkQueueData_t> pusher{&blockingChunkData};
+    ConditionListener spaceAvailableListener{*blockingChunkData.m_spaceAvailableConditionVariableData};
+
+    EXPECT_TRUE(pusher.push(this->allocateChunk()));
+    blockingChunkData.m_numberOfBlockedProducers.store(1U);
+
+    popper.clear();
+
+    EXPECT_THAT(spaceAvailableListener.timedWait(1_ns).empty(), Eq(false));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
 using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
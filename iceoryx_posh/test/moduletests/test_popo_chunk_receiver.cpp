@@ -232,6 +232,82 @@ TEST_F(ChunkReceiver_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkReceiver_test, getBatchFromEmptyQueueReturnsNoChunkAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "45c30dd4-f5a7-43e9-b6c1-772e10542fb8");
+    const iox::mepoo::ChunkHeader* chunkHeaders[4];
+    auto result = m_chunkReceiver.tryGetBatch(iox::span<const iox::mepoo::ChunkHeader*>(chunkHeaders));
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+}
+
+TEST_F(ChunkReceiver_test, getBatchReturnsAllQueuedChunksInOrderAndReleasesThemIndividually)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1ccc5b67-debb-4595-8578-2411995024d0");
+    constexpr uint64_t NUMBER_OF_CHUNKS{5U};
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        ASSERT_TRUE(sharedChunk);
+        new (sharedChunk.getUserPayload()) DummySample{i};
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS + 3U];
+    auto result = m_chunkReceiver.tryGetBatch(iox::span<const iox::mepoo::ChunkHeader*>(chunkHeaders));
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_TRUE(m_chunkReceiver.empty());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        EXPECT_THAT(static_cast<const DummySample*>(chunkHeaders[i]->userPayload())->dummy, Eq(i));
+        m_chunkReceiver.release(chunkHeaders[i]);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getBatchIsLimitedByTheNumberOfChunksWhichCanStillBeHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b1ba77d1-0083-4dc6-aa3e-c4218859c611");
+    constexpr uint64_t FREE_SLOTS{2U};
+    for (uint64_t i = 0; i < iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1U - FREE_SLOTS; i++)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        ASSERT_FALSE(m_chunkReceiver.tryGet().has_error());
+    }
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{4U};
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+    }
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    auto result = m_chunkReceiver.tryGetBatch(iox::span<const iox::mepoo::ChunkHeader*>(chunkHeaders));
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(FREE_SLOTS));
+    EXPECT_THAT(m_chunkReceiver.size(), Eq(NUMBER_OF_CHUNKS - FREE_SLOTS));
+}
+
+TEST_F(ChunkReceiver_test, getBatchWithoutFreeSlotsFailsAndKeepsTheChunksInTheQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d26ace12-c9eb-4492-93b2-1eb9396b55d2");
+    for (uint64_t i = 0; i < iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1U; i++)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        ASSERT_FALSE(m_chunkReceiver.tryGet().has_error());
+    }
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[4];
+    auto result = m_chunkReceiver.tryGetBatch(iox::span<const iox::mepoo::ChunkHeader*>(chunkHeaders));
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+    EXPECT_THAT(m_chunkReceiver.size(), Eq(1U));
+}
+
 TEST_F(ChunkReceiver_test, asStringLiteralConvertsChunkReceiveResultValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5cbbda34-8a22-4eab-a8b6-20da345c1707");
@@ -492,6 +492,90 @@ TEST_F(ChunkSender_test, sendInvalidChunk)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
 }
 
+TEST_F(ChunkSender_test, sendBatchWithReceiverDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "18a66770-585b-42ad-83bf-edf811614495");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint64_t BATCH_SIZE{4U};
+    iox::mepoo::ChunkHeader* chunkHeaders[BATCH_SIZE];
+    for (uint64_t i = 0; i < BATCH_SIZE; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          USER_HEADER_SIZE,
+                                                          USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        new ((*maybeChunkHeader)->userPayload()) DummySample();
+        static_cast<DummySample*>((*maybeChunkHeader)->userPayload())->dummy = i;
+        chunkHeaders[i] = *maybeChunkHeader;
+    }
+
+    auto numberOfDeliveries = m_chunkSender.sendBatch(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders));
+    EXPECT_THAT(numberOfDeliveries, Eq(BATCH_SIZE));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint64_t i = 0; i < BATCH_SIZE; i++)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        auto dummySample = *reinterpret_cast<DummySample*>(popRet->getUserPayload());
+        EXPECT_THAT(dummySample.dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+}
+
+TEST_F(ChunkSender_test, sendBatchWithoutReceiverKeepsOnlyTheLastChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5bc8e81c-4b31-46c4-bd1c-ea0edcc5fba2");
+    constexpr uint64_t BATCH_SIZE{3U};
+    iox::mepoo::ChunkHeader* chunkHeaders[BATCH_SIZE];
+    for (auto& chunkHeader : chunkHeaders)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          USER_HEADER_SIZE,
+                                                          USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeader = *maybeChunkHeader;
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(BATCH_SIZE));
+
+    auto numberOfDeliveries = m_chunkSender.sendBatch(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders));
+    EXPECT_THAT(numberOfDeliveries, Eq(0U));
+
+    // the last chunk is kept for the reuse in the next allocation
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_TRUE(m_chunkSender.tryGetPreviousChunk().has_value());
+    EXPECT_THAT(m_chunkSender.tryGetPreviousChunk().value(), Eq(chunkHeaders[BATCH_SIZE - 1U]));
+}
+
+TEST_F(ChunkSender_test, sendBatchWithInvalidChunkSendsOnlyTheValidChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "81cca490-6b69-4a4d-8e01-d74fa56f54a4");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                      sizeof(DummySample),
+                                                      alignof(DummySample),
+                                                      USER_HEADER_SIZE,
+                                                      USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    ChunkMock<bool> myCrazyChunk;
+    iox::mepoo::ChunkHeader* chunkHeaders[]{myCrazyChunk.chunkHeader(), *maybeChunkHeader};
+    auto numberOfDeliveries = m_chunkSender.sendBatch(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders));
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    EXPECT_THAT(myQueue.size(), Eq(1U));
+}
+
 TEST_F(ChunkSender_test, sendToQueueWithoutReceiverReturnsFalse)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7139bfdc-3df9-4def-a292-407f8e650b34");
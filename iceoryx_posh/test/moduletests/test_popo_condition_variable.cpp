@@ -28,6 +28,7 @@
 #include <memory>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace
 {
@@ -135,9 +136,9 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
     {
-        EXPECT_THAT(notification.load(), Eq(false));
+        EXPECT_THAT(sut.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -150,9 +151,9 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
     {
-        EXPECT_THAT(notification.load(), Eq(false));
+        EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -166,11 +167,11 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i].load(), Eq(true));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i].load(), Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     }
 }
@@ -233,6 +234,38 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsAllNotifiedIndices)
     }
 }
 
+TEST_F(ConditionVariable_test, TimedWaitReturnsNotifiedIndicesAtNotificationWordBoundariesSorted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a5eafd8-4d3e-462c-acbd-8d65681dd7dd");
+    ConditionListener sut(m_condVarData);
+    constexpr uint64_t NOTIFICATIONS_PER_WORD{ConditionVariableData::NOTIFICATIONS_PER_WORD};
+    // notify in reverse order the first and last index of every notification word
+    std::vector<uint64_t> expectedIndices;
+    for (uint64_t wordStart = 0U; wordStart < iox::MAX_NUMBER_OF_NOTIFIERS; wordStart += NOTIFICATIONS_PER_WORD)
+    {
+        expectedIndices.push_back(wordStart);
+        const uint64_t wordEnd =
+            iox::algorithm::minVal(wordStart + NOTIFICATIONS_PER_WORD, uint64_t{iox::MAX_NUMBER_OF_NOTIFIERS}) - 1U;
+        if (wordEnd != wordStart)
+        {
+            expectedIndices.push_back(wordEnd);
+        }
+    }
+    for (auto index = expectedIndices.rbegin(); index != expectedIndices.rend(); ++index)
+    {
+        ConditionNotifier(m_condVarData, *index).notify();
+    }
+
+    auto indices = sut.timedWait(iox::units::Duration::fromMilliseconds(100));
+
+    ASSERT_THAT(indices.size(), Eq(expectedIndices.size()));
+    for (uint64_t i = 0U; i < expectedIndices.size(); ++i)
+    {
+        EXPECT_THAT(indices[i], Eq(expectedIndices[i]));
+    }
+    EXPECT_THAT(sut.wasNotified(), Eq(false));
+}
+
 TIMING_TEST_F(ConditionVariable_test, TimedWaitBlocksUntilTimeout, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "c755aec9-43c3-4bf4-bec4-5672c76561ef");
     ConditionListener listener(m_condVarData);
@@ -420,9 +453,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
         {
-            EXPECT_THAT(notification.load(), Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     });
 
@@ -0,0 +1,118 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class LatencyHistogram_test : public Test
+{
+  public:
+    LatencyHistogram sut;
+};
+
+TEST_F(LatencyHistogram_test, NewHistogramIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4989e8b-548b-4758-b4bd-1cd511fa190c");
+    for (uint32_t i = 0U; i < LatencyHistogram::NUMBER_OF_BUCKETS; ++i)
+    {
+        EXPECT_THAT(sut.count(i), Eq(0U));
+    }
+    EXPECT_THAT(sut.totalCount(), Eq(0U));
+}
+
+TEST_F(LatencyHistogram_test, LatencyBelowOneMicrosecondIsInFirstBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ea71f080-e36d-48e7-81a7-6f208d86ff79");
+    EXPECT_THAT(LatencyHistogram::bucketIndex(0_ns), Eq(0U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(999_ns), Eq(0U));
+}
+
+TEST_F(LatencyHistogram_test, BucketsAreLogarithmicInMicroseconds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "00d1766e-976f-4461-8145-dc4fc5c9f8a7");
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1_us), Eq(1U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(2_us), Eq(2U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(3_us), Eq(2U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(4_us), Eq(3U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1023_us), Eq(10U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1024_us), Eq(11U));
+}
+
+TEST_F(LatencyHistogram_test, LatencyBeyondRangeIsInLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d4129293-1173-4e8e-b910-a0795e3ddbbb");
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1_h), Eq(LatencyHistogram::NUMBER_OF_BUCKETS - 1U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(iox::units::Duration::max()),
+                Eq(LatencyHistogram::NUMBER_OF_BUCKETS - 1U));
+}
+
+TEST_F(LatencyHistogram_test, RecordIncrementsCorrespondingBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "04b41251-0833-449c-a370-8a4a992f35e7");
+    sut.record(10_us);
+    sut.record(12_us);
+    sut.record(1_ms);
+
+    EXPECT_THAT(sut.count(LatencyHistogram::bucketIndex(10_us)), Eq(2U));
+    EXPECT_THAT(sut.count(LatencyHistogram::bucketIndex(1_ms)), Eq(1U));
+    EXPECT_THAT(sut.totalCount(), Eq(3U));
+}
+
+TEST_F(LatencyHistogram_test, CountOfOutOfRangeBucketIsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7632a6ad-92ef-43b0-9ca4-2aaa20279d41");
+    sut.record(1_h);
+    EXPECT_THAT(sut.count(LatencyHistogram::NUMBER_OF_BUCKETS), Eq(0U));
+}
+
+TEST_F(LatencyHistogram_test, ConcurrentRecordsAreNotLost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0bc17a97-4d90-452a-8737-0cc4deca92ec");
+    constexpr uint64_t NUMBER_OF_THREADS{4U};
+    constexpr uint64_t RECORDS_PER_THREAD{10000U};
+
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&] {
+            for (uint64_t k = 0U; k < RECORDS_PER_THREAD; ++k)
+            {
+                sut.record(5_us);
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    EXPECT_THAT(sut.count(LatencyHistogram::bucketIndex(5_us)), Eq(NUMBER_OF_THREADS * RECORDS_PER_THREAD));
+
+    sut.reset();
+    EXPECT_THAT(sut.totalCount(), Eq(0U));
+}
+
+} // namespace
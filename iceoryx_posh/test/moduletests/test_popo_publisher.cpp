@@ -274,6 +274,81 @@ TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, LoanBatchLoansTheRequestedNumberOfSamplesAndCallsCustomCtor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c7c2b6bd-3520-4d99-b0df-5aa29d6fbe99");
+    constexpr uint64_t CUSTOM_VALUE{37};
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::ok(secondChunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U, CUSTOM_VALUE);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().size(), 2U);
+    EXPECT_EQ(chunkMock.chunkHeader(), result.value()[0].getChunkHeader());
+    EXPECT_EQ(secondChunkMock.chunkHeader(), result.value()[1].getChunkHeader());
+    EXPECT_EQ(result.value()[0]->val, CUSTOM_VALUE);
+    EXPECT_EQ(result.value()[1]->val, CUSTOM_VALUE);
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    EXPECT_CALL(portMock, releaseChunk(secondChunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, LoanBatchWithMoreSamplesThanAllowedFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3197cf67-168a-40cb-bb6b-41462b098e8e");
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, _, _)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanBatch(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, LoanBatchReleasesAlreadyLoanedSamplesOnFailure)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9b7e5ad-5e1a-4e96-acea-dedcee033c97");
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, PublishBatchSendsAllChunksWithASingleCallOnPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1fe8881f-5392-4698-a12c-3a26d045768b");
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::ok(secondChunkMock.chunkHeader()))));
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_))
+        .WillOnce(Invoke([&](const iox::span<iox::mepoo::ChunkHeader* const> chunkHeaders) {
+            sentChunkHeaders.assign(chunkHeaders.begin(), chunkHeaders.end());
+        }));
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U);
+    ASSERT_FALSE(result.has_error());
+    sut.publishBatch(iox::span<iox::popo::Sample<DummyData>>(result.value()));
+    // ===== Verify ===== //
+    ASSERT_EQ(sentChunkHeaders.size(), 2U);
+    EXPECT_EQ(sentChunkHeaders[0], chunkMock.chunkHeader());
+    EXPECT_EQ(sentChunkHeaders[1], secondChunkMock.chunkHeader());
+    EXPECT_FALSE(result.value()[0]);
+    EXPECT_FALSE(result.value()[1]);
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(PublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
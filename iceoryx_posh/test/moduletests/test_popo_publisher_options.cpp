@@ -32,6 +32,7 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.deliveryMode = iox::popo::QueueDeliveryMode::LOCK_FREE_SNAPSHOT;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +47,9 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.deliveryMode, Ne(defaultOptions.deliveryMode));
+            EXPECT_THAT(roundTripOptions.deliveryMode, Eq(testOptions.deliveryMode));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -66,9 +70,29 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
     constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{111};
+    constexpr std::underlying_type_t<iox::popo::QueueDeliveryMode> DELIVERY_MODE{
+        static_cast<std::underlying_type_t<iox::popo::QueueDeliveryMode>>(iox::popo::QueueDeliveryMode::LOCKED)};
+
+    const auto serialized = iox::Serialization::create(
+        HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY, DELIVERY_MODE);
+    iox::popo::PublisherOptions::deserialize(serialized)
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
+TEST(PublisherOptions_test, DeserializingInvalidDeliveryModeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9ac54bf0-0bc6-40c2-8ef5-c4fecd94b812");
+    constexpr uint64_t HISTORY_CAPACITY{42U};
+    const iox::NodeName_t NODE_NAME{"harr-harr"};
+    constexpr bool OFFER_ON_CREATE{true};
+    constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{
+        static_cast<std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy>>(
+            iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)};
+    constexpr std::underlying_type_t<iox::popo::QueueDeliveryMode> DELIVERY_MODE{111};
 
-    const auto serialized =
-        iox::Serialization::create(HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY);
+    const auto serialized = iox::Serialization::create(
+        HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY, DELIVERY_MODE);
     iox::popo::PublisherOptions::deserialize(serialized)
         .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
         .or_else([&](auto&) { GTEST_SUCCEED(); });
@@ -177,6 +177,64 @@ TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
     // ===== Cleanup ===== //
 }
 
+TEST_F(SubscriberTest, TakeBatchReturnsAllTakenChunksWrappedInSamples)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e19a532e-0f91-4b24-befd-6a99a6ef656a");
+    // ===== Setup ===== //
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(sut, takeChunks)
+        .Times(1)
+        .WillOnce(Invoke([&](const iox::span<const iox::mepoo::ChunkHeader*> chunkHeaders) {
+            EXPECT_THAT(chunkHeaders.size(), Eq(3U));
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::expected<uint64_t, iox::popo::ChunkReceiveResult>(iox::ok<uint64_t>(2U));
+        }));
+    EXPECT_CALL(sut.port(), releaseChunk).Times(2);
+    // ===== Test ===== //
+    {
+        auto maybeSamples = sut.takeBatch(3U);
+        // ===== Verify ===== //
+        ASSERT_FALSE(maybeSamples.has_error());
+        ASSERT_THAT(maybeSamples.value().size(), Eq(2U));
+        EXPECT_EQ(maybeSamples.value()[0].get(), chunkMock.chunkHeader()->userPayload());
+        EXPECT_EQ(maybeSamples.value()[1].get(), secondChunkMock.chunkHeader()->userPayload());
+    }
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeBatchForwardsErrorOfBaseSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "70c7955d-e213-401d-ac00-509287a0118a");
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunks)
+        .Times(1)
+        .WillOnce(Return(ByMove(iox::err(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE))));
+    // ===== Test ===== //
+    auto maybeSamples = sut.takeBatch(3U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(maybeSamples.has_error());
+    EXPECT_THAT(maybeSamples.error(), Eq(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeBatchLimitsNumberOfSamplesToCapacityOfSampleBatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "827920a4-5166-4e0f-b533-aa0a3a23558d");
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunks)
+        .Times(1)
+        .WillOnce(Invoke([](const iox::span<const iox::mepoo::ChunkHeader*> chunkHeaders) {
+            EXPECT_THAT(chunkHeaders.size(), Eq(TestSubscriber::SampleBatch::capacity()));
+            return iox::expected<uint64_t, iox::popo::ChunkReceiveResult>(
+                iox::err(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+        }));
+    // ===== Test ===== //
+    EXPECT_TRUE(sut.takeBatch(TestSubscriber::SampleBatch::capacity() + 1U).has_error());
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
 TEST_F(SubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f30fe1ae-046c-48b3-b5cd-b9adbf9b864f");
@@ -137,6 +137,76 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, LoanBatchLoansTheRequestedNumberOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd70c3da-64c8-4268-8b5d-7f4a6d4a1bfe");
+    constexpr uint64_t USER_PAYLOAD_SIZE = 11U;
+    ChunkMock<uint64_t> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(USER_PAYLOAD_SIZE, _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::ok(secondChunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    void* userPayloads[2]{nullptr, nullptr};
+    auto result = sut.loanBatch(iox::span<void*>(userPayloads), USER_PAYLOAD_SIZE);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(userPayloads[0], chunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[1], secondChunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, LoanBatchReleasesAlreadyLoanedChunksOnFailure)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "73d1f7d1-5aa0-40bb-9d7f-3d891ced3d1a");
+    constexpr uint64_t USER_PAYLOAD_SIZE = 13U;
+    EXPECT_CALL(portMock, tryAllocateChunk(USER_PAYLOAD_SIZE, _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader())).Times(1);
+    // ===== Test ===== //
+    void* userPayloads[2]{nullptr, nullptr};
+    auto result = sut.loanBatch(iox::span<void*>(userPayloads), USER_PAYLOAD_SIZE);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.error());
+    EXPECT_EQ(userPayloads[0], nullptr);
+    EXPECT_EQ(userPayloads[1], nullptr);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, LoanBatchWithMoreChunksThanAllowedFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a4dddbc-f659-40ff-a81e-48112eac27c9");
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, _, _)).Times(0);
+    // ===== Test ===== //
+    void* userPayloads[iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1U]{};
+    auto result = sut.loanBatch(iox::span<void*>(userPayloads), 1U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, PublishBatchSendsAllUserPayloadsWithASingleCallOnUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a4a9a34-4dcd-45cb-8545-99d811e017a2");
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> secondChunkMock;
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_))
+        .WillOnce(Invoke([&](const iox::span<iox::mepoo::ChunkHeader* const> chunkHeaders) {
+            sentChunkHeaders.assign(chunkHeaders.begin(), chunkHeaders.end());
+        }));
+    // ===== Test ===== //
+    void* userPayloads[]{chunkMock.chunkHeader()->userPayload(), secondChunkMock.chunkHeader()->userPayload()};
+    sut.publishBatch(iox::span<void* const>(userPayloads));
+    // ===== Verify ===== //
+    ASSERT_EQ(sentChunkHeaders.size(), 2U);
+    EXPECT_EQ(sentChunkHeaders[0], chunkMock.chunkHeader());
+    EXPECT_EQ(sentChunkHeaders[1], secondChunkMock.chunkHeader());
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
@@ -159,6 +159,47 @@ TEST_F(UntypedSubscriberTest, TakeReturnsAllocatedMemoryChunk)
     sut.release(maybeChunk.value());
 }
 
+TEST_F(UntypedSubscriberTest, TakeBatchReturnsAllTakenChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f17b6b7d-adc4-44ac-b723-3a624304aa65");
+    // ===== Setup ===== //
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(sut, takeChunks)
+        .Times(1)
+        .WillOnce(Invoke([&](const iox::span<const iox::mepoo::ChunkHeader*> chunkHeaders) {
+            EXPECT_THAT(chunkHeaders.size(), Eq(3U));
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::expected<uint64_t, iox::popo::ChunkReceiveResult>(iox::ok<uint64_t>(2U));
+        }));
+    // ===== Test ===== //
+    const void* userPayloads[3]{nullptr, nullptr, nullptr};
+    auto numberOfChunks = sut.takeBatch(iox::span<const void*>(userPayloads));
+    // ===== Verify ===== //
+    ASSERT_FALSE(numberOfChunks.has_error());
+    ASSERT_THAT(numberOfChunks.value(), Eq(2U));
+    EXPECT_EQ(userPayloads[0], chunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[1], secondChunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[2], nullptr);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedSubscriberTest, TakeBatchForwardsErrorOfBaseSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d46e2d5-ba79-44f8-8287-fa9d8cbd341e");
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunks)
+        .Times(1)
+        .WillOnce(Return(ByMove(iox::err(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL))));
+    // ===== Test ===== //
+    const void* userPayloads[3];
+    auto numberOfChunks = sut.takeBatch(iox::span<const void*>(userPayloads));
+    // ===== Verify ===== //
+    ASSERT_TRUE(numberOfChunks.has_error());
+    EXPECT_THAT(numberOfChunks.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+    // ===== Cleanup ===== //
+}
+
 TEST_F(UntypedSubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "66c0fb02-aa6d-48dd-8439-754e05cd29af");
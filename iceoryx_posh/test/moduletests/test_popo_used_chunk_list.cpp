@@ -23,6 +23,9 @@
 
 #include "test.hpp"
 
+#include <algorithm>
+#include <random>
+
 namespace
 {
 using namespace ::testing;
@@ -316,4 +319,110 @@ TEST_F(UsedChunkList_test, CallingCleanupReleasesAllChunks)
     EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
     checkIfEmpty();
 }
+
+TEST_F(UsedChunkList_test, FreeSlotsOfNewlyCreatedListEqualsCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9fb3f46b-bf29-4e8c-aa4c-20211e6a0c88");
+    EXPECT_THAT(sut.freeSlots(), Eq(USED_CHUNK_LIST_CAPACITY));
+}
+
+TEST_F(UsedChunkList_test, FreeSlotsAreTrackedOnInsertAndRemove)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "357a494f-d1cb-46c8-882f-dc0cca91c191");
+    auto chunk = getChunkFromMemoryManager();
+    auto* chunkHeader = chunk.getChunkHeader();
+    ASSERT_TRUE(sut.insert(chunk));
+    ASSERT_TRUE(sut.insert(getChunkFromMemoryManager()));
+    EXPECT_THAT(sut.freeSlots(), Eq(USED_CHUNK_LIST_CAPACITY - 2U));
+
+    SharedChunk removedChunk;
+    ASSERT_TRUE(sut.remove(chunkHeader, removedChunk));
+    EXPECT_THAT(sut.freeSlots(), Eq(USED_CHUNK_LIST_CAPACITY - 1U));
+
+    sut.cleanup();
+    EXPECT_THAT(sut.freeSlots(), Eq(USED_CHUNK_LIST_CAPACITY));
+}
+
+TEST_F(UsedChunkList_test, MultipleChunksCanBeInsertedAtOnceAndRemovedIndividually)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ec9f9d0e-d020-485f-a9bc-f3941c16a72c");
+    std::vector<SharedChunk> chunks;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY / 2U, [&](SharedChunk&& chunk) { chunks.push_back(chunk); });
+
+    EXPECT_THAT(sut.insert(iox::span<const SharedChunk>(chunks)), Eq(chunks.size()));
+    EXPECT_THAT(sut.freeSlots(), Eq(USED_CHUNK_LIST_CAPACITY - chunks.size()));
+
+    for (const auto& chunk : chunks)
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+        EXPECT_THAT(removedChunk, Eq(chunk));
+    }
+    EXPECT_THAT(sut.freeSlots(), Eq(USED_CHUNK_LIST_CAPACITY));
+}
+
+TEST_F(UsedChunkList_test, InsertingMoreChunksAtOnceThanFreeSlotsInsertsOnlyTheFirstChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ea413b4-e521-4561-9428-21febfc06cbd");
+    std::vector<SharedChunk> chunks;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY + 2U, [&](SharedChunk&& chunk) { chunks.push_back(chunk); });
+
+    EXPECT_THAT(sut.insert(iox::span<const SharedChunk>(chunks)), Eq(USED_CHUNK_LIST_CAPACITY));
+    EXPECT_THAT(sut.freeSlots(), Eq(0U));
+
+    SharedChunk removedChunk;
+    EXPECT_TRUE(sut.remove(chunks[0].getChunkHeader(), removedChunk));
+    EXPECT_FALSE(sut.remove(chunks[USED_CHUNK_LIST_CAPACITY].getChunkHeader(), removedChunk));
+}
+
+TEST_F(UsedChunkList_test, InsertingMultipleChunksAtOnceKeepsTheChunksAlive)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "96300b0f-8f3a-4e8a-bc23-f61379f1d62f");
+    {
+        std::vector<SharedChunk> chunks;
+        createMultipleChunks(3U, [&](SharedChunk&& chunk) { chunks.push_back(chunk); });
+        sut.insert(iox::span<const SharedChunk>(chunks));
+    }
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(3U));
+
+    sut.cleanup();
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(UsedChunkList_test, InterleavedInsertAndRemoveInRandomOrderReturnsTheRequestedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "db200c82-6347-4039-b340-9a1f22afee3d");
+    // the fixed seed makes failures reproducible; the many rounds exercise the backward shift of the index table
+    std::mt19937 randomGenerator{42U};
+    std::vector<SharedChunk> chunksInUse;
+    constexpr uint32_t NUMBER_OF_ROUNDS{1000U};
+    for (uint32_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        while (chunksInUse.size() < USED_CHUNK_LIST_CAPACITY)
+        {
+            auto chunk = getChunkFromMemoryManager();
+            ASSERT_TRUE(sut.insert(chunk));
+            chunksInUse.push_back(chunk);
+        }
+
+        std::shuffle(chunksInUse.begin(), chunksInUse.end(), randomGenerator);
+        const auto numberOfChunksToRemove = 1U + randomGenerator() % USED_CHUNK_LIST_CAPACITY;
+        for (uint32_t i = 0U; i < numberOfChunksToRemove; ++i)
+        {
+            SharedChunk removedChunk;
+            ASSERT_TRUE(sut.remove(chunksInUse.back().getChunkHeader(), removedChunk));
+            EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunksInUse.back().getChunkHeader()));
+            chunksInUse.pop_back();
+        }
+        EXPECT_THAT(sut.freeSlots(), Eq(USED_CHUNK_LIST_CAPACITY - chunksInUse.size()));
+    }
+
+    for (const auto& chunk : chunksInUse)
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+    }
+    checkIfEmpty();
+}
 } // namespace
@@ -38,7 +38,8 @@ class VariantQueue_test : public Test
 };
 
 using QueueTypes =
-    Types<std::integral_constant<VariantQueueTypes, VariantQueueTypes::FiFo_MultiProducerSingleConsumer>>;
+    Types<std::integral_constant<VariantQueueTypes, VariantQueueTypes::FiFo_MultiProducerSingleConsumer>,
+          std::integral_constant<VariantQueueTypes, VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity>>;
 
 TYPED_TEST_SUITE(VariantQueue_test, QueueTypes, );
 
@@ -121,4 +122,111 @@ TYPED_TEST(VariantQueue_test, noPopWhenEmpty)
     EXPECT_THAT(sut.pop().has_value(), Eq(false));
 }
 
+TYPED_TEST(VariantQueue_test, popBatchWhenEmptyReturnsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "793d5fed-a45c-490b-a135-c7944bb38b90");
+    VariantQueue<int32_t, 5> sut(TypeParam::value);
+    int32_t elements[5];
+    EXPECT_THAT(sut.popBatch(span<int32_t>(elements)), Eq(0U));
+}
+
+TYPED_TEST(VariantQueue_test, popBatchIsLimitedBySizeOfProvidedStorage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "79cc1f93-1991-46f5-bc71-ff56e8da2259");
+    VariantQueue<int32_t, 5> sut(TypeParam::value);
+    sut.push(14123);
+    sut.push(24123);
+    sut.push(34123);
+
+    int32_t elements[2];
+    ASSERT_THAT(sut.popBatch(span<int32_t>(elements)), Eq(2U));
+    EXPECT_THAT(elements[0], Eq(14123));
+    EXPECT_THAT(elements[1], Eq(24123));
+
+    auto element = sut.pop();
+    ASSERT_THAT(element.has_value(), Eq(true));
+    EXPECT_THAT(element.value(), Eq(34123));
+}
+
+TEST(VariantQueuePopBatch_test, popBatchReturnsAllPushedElementsInOrderForAllQueueTypes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1cf7f3d3-165a-4be6-9959-e9705cd4587e");
+    for (auto queueType : {VariantQueueTypes::FiFo_SingleProducerSingleConsumer,
+                           VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                           VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                           VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                           VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity,
+                           VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity})
+    {
+        SCOPED_TRACE(static_cast<uint64_t>(queueType));
+        VariantQueue<int32_t, 5> sut(queueType);
+        sut.push(14123);
+        sut.push(24123);
+        sut.push(34123);
+
+        int32_t elements[5];
+        ASSERT_THAT(sut.popBatch(span<int32_t>(elements)), Eq(3U));
+        EXPECT_THAT(elements[0], Eq(14123));
+        EXPECT_THAT(elements[1], Eq(24123));
+        EXPECT_THAT(elements[2], Eq(34123));
+        EXPECT_THAT(sut.empty(), Eq(true));
+    }
+}
+
+TEST(VariantQueueFixedCapacity_test, setCapacityOnlySucceedsWithTheFixedCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a985f1d-a987-4cbe-b2ee-e3c53c2b1c9a");
+    for (auto queueType : {VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity,
+                           VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity})
+    {
+        SCOPED_TRACE(static_cast<uint64_t>(queueType));
+        VariantQueue<int32_t, 5> sut(queueType);
+        EXPECT_THAT(sut.setCapacity(5U), Eq(true));
+        EXPECT_THAT(sut.setCapacity(3U), Eq(false));
+        EXPECT_THAT(sut.capacity(), Eq(5U));
+    }
+}
+
+TEST(VariantQueueFixedCapacity_test, fifoRejectsNewValueWhenFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d42ab1b9-9c07-409a-a726-0abad2a9921f");
+    VariantQueue<int32_t, 2> sut(VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity);
+    EXPECT_THAT(sut.push(1).has_value(), Eq(false));
+    EXPECT_THAT(sut.push(2).has_value(), Eq(false));
+
+    auto rejectedValue = sut.push(3);
+    ASSERT_THAT(rejectedValue.has_value(), Eq(true));
+    EXPECT_THAT(rejectedValue.value(), Eq(3));
+    EXPECT_THAT(sut.size(), Eq(2U));
+    EXPECT_THAT(sut.pop().value(), Eq(1));
+}
+
+TEST(VariantQueueFixedCapacity_test, sofiDiscardsOldestValueWhenFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf559f32-1dbe-4617-90b6-06f7b37f2126");
+    VariantQueue<int32_t, 2> sut(VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity);
+    EXPECT_THAT(sut.push(1).has_value(), Eq(false));
+    EXPECT_THAT(sut.push(2).has_value(), Eq(false));
+
+    auto discardedValue = sut.push(3);
+    ASSERT_THAT(discardedValue.has_value(), Eq(true));
+    EXPECT_THAT(discardedValue.value(), Eq(1));
+    EXPECT_THAT(sut.size(), Eq(2U));
+    EXPECT_THAT(sut.pop().value(), Eq(2));
+    EXPECT_THAT(sut.pop().value(), Eq(3));
+}
+
+TEST(VariantQueueFixedCapacity_test, multiProducerQueueTypeSelectsFixedCapacityQueueOnlyForMaxCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf2dfb8e-2a40-4dab-9859-9a0b75b6db95");
+    EXPECT_THAT(multiProducerQueueType(QueueFullPolicy::BLOCK_PRODUCER, 8U, 8U),
+                Eq(VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity));
+    EXPECT_THAT(multiProducerQueueType(QueueFullPolicy::DISCARD_OLDEST_DATA, 8U, 8U),
+                Eq(VariantQueueTypes::SoFi_MultiProducerSingleConsumer_FixedCapacity));
+    EXPECT_THAT(multiProducerQueueType(QueueFullPolicy::BLOCK_PRODUCER, 4U, 8U),
+                Eq(VariantQueueTypes::FiFo_MultiProducerSingleConsumer));
+    EXPECT_THAT(multiProducerQueueType(QueueFullPolicy::DISCARD_OLDEST_DATA, 4U, 8U),
+                Eq(VariantQueueTypes::SoFi_MultiProducerSingleConsumer));
+}
+
 } // namespace
@@ -346,9 +346,13 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     iox::vector<iox::capro::ServiceDescription, iox::NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const iox::capro::ServiceDescription serviceRegistry{
         iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
+    const iox::capro::ServiceDescription serviceRegistryDelta{iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                                                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                                                              iox::SERVICE_DISCOVERY_DELTA_EVENT_NAME};
 
     // Added by PortManager
     internalServices.push_back(serviceRegistry);
+    internalServices.push_back(serviceRegistryDelta);
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
@@ -698,16 +702,18 @@ TEST_F(PoshRuntime_test, GetMiddlewareClientWhenMaxClientsAreUsedResultsInClient
     IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__CLIENTLIST_OVERFLOW);
 }
 
-TEST_F(PoshRuntime_test, GetMiddlewareClientWithInvalidNodeNameLeadsToErrorHandlerCall)
+TEST_F(PoshRuntime_test, GetMiddlewareClientWithNodeNameContainingTextSeparatorIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b4433dfd-d2f8-4567-9483-aed956275ce8");
     const iox::capro::ServiceDescription sd{"great", "gig", "sky"};
     iox::popo::ClientOptions clientOptions;
+    // the node name would break a text message but is transferred unchanged with the binary IPC message protocol
     clientOptions.nodeName = m_invalidNodeName;
 
-    m_runtime->getMiddlewareClient(sd, clientOptions);
+    auto clientPort = m_runtime->getMiddlewareClient(sd, clientOptions);
 
-    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_INVALID_RESPONSE);
+    ASSERT_THAT(clientPort, Ne(nullptr));
+    IOX_TESTING_EXPECT_OK();
 }
 
 TEST_F(PoshRuntime_test, GetMiddlewareServerWithDefaultArgsIsSuccessful)
@@ -794,16 +800,18 @@ TEST_F(PoshRuntime_test, GetMiddlewareServerWhenMaxServerAreUsedResultsInServerl
     IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__SERVERLIST_OVERFLOW);
 }
 
-TEST_F(PoshRuntime_test, GetMiddlewareServerWithInvalidNodeNameLeadsToErrorHandlerCall)
+TEST_F(PoshRuntime_test, GetMiddlewareServerWithNodeNameContainingTextSeparatorIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "95603ddc-1051-4dd7-a163-1c621f8a211a");
     const iox::capro::ServiceDescription sd{"it's", "over", "now"};
     iox::popo::ServerOptions serverOptions;
+    // the node name would break a text message but is transferred unchanged with the binary IPC message protocol
     serverOptions.nodeName = m_invalidNodeName;
 
-    m_runtime->getMiddlewareServer(sd, serverOptions);
+    auto serverPort = m_runtime->getMiddlewareServer(sd, serverOptions);
 
-    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE);
+    ASSERT_THAT(serverPort, Ne(nullptr));
+    IOX_TESTING_EXPECT_OK();
 }
 
 TEST_F(PoshRuntime_test, GetMiddlewareConditionVariableIsSuccessful)
@@ -39,6 +39,7 @@ bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
            && (lhs.roudiConfig.compatibilityCheckLevel == rhs.roudiConfig.compatibilityCheckLevel)
            && (lhs.roudiConfig.processTerminationDelay == rhs.roudiConfig.processTerminationDelay)
            && (lhs.roudiConfig.processKillDelay == rhs.roudiConfig.processKillDelay)
+           && (lhs.roudiConfig.runtimeMessagesThreadCount == rhs.roudiConfig.runtimeMessagesThreadCount)
            && (lhs.roudiConfig.domainId == rhs.roudiConfig.domainId)
            && (lhs.roudiConfig.uniqueRouDiId == rhs.roudiConfig.uniqueRouDiId) && (lhs.run == rhs.run)
            && (lhs.configFilePath == rhs.configFilePath);
@@ -350,6 +351,84 @@ TEST_F(CmdLineParser_test, KillDelayOptionOutOfBoundsLeadsToError)
     EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
 }
 
+TEST_F(CmdLineParser_test, RuntimeMessageThreadsLongOptionLeadsToCorrectThreadCount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "676d0279-f360-4466-9a26-ae2f09fcb13b");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-threads";
+    char value[] = "4";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().roudiConfig.runtimeMessagesThreadCount, 4U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageThreadsShortOptionLeadsToCorrectThreadCount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a10f1aec-65fe-47d4-b8a5-0612e49289bf");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-r";
+    char value[] = "16";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().roudiConfig.runtimeMessagesThreadCount, iox::roudi::MAX_RUNTIME_MESSAGES_THREADS);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageThreadsOptionWithZeroThreadsLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d925eb4e-b50e-4fd1-ae2c-c34d4de3a390");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-threads";
+    char value[] = "0";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageThreadsOptionOutOfBoundsLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ea68ab79-7512-48ae-9393-34fbdc574531");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-threads";
+    char value[] = "17"; // MAX_RUNTIME_MESSAGES_THREADS + 1
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
+}
+
 TEST_F(CmdLineParser_test, TerminationDelayLongOptionLeadsToCorrectDelay)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9125f775-93b6-4560-a535-f8ecf77671b5");
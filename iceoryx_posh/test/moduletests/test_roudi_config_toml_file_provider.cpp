@@ -98,6 +98,145 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
     });
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingChunkCacheDepthIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f97212fc-8a90-44c8-bf7c-481507e96004");
+    constexpr uint32_t EXPECTED_CHUNK_CACHE_DEPTH{32U};
+
+    auto tempFilePath = std::filesystem::temp_directory_path();
+    tempFilePath.append("test_roudi_config_chunk_cache.toml");
+
+    std::fstream tempFile{tempFilePath, std::ios_base::trunc | std::ios_base::out};
+    ASSERT_TRUE(tempFile.is_open());
+    tempFile << R"([general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 100
+        chunk-cache-depth = 32
+
+        [[segment.mempool]]
+        size = 256
+        count = 100
+    )";
+    tempFile.close();
+
+    cmdLineArgs.configFilePath =
+        iox::roudi::ConfigFilePathString_t(iox::TruncateToCapacity, tempFilePath.u8string().c_str());
+
+    iox::config::TomlRouDiConfigFileProvider sut(cmdLineArgs);
+
+    sut.parse()
+        .and_then([&](const auto& config) {
+            ASSERT_THAT(config.m_sharedMemorySegments.size(), Eq(1U));
+            const auto& mempools = config.m_sharedMemorySegments[0].m_mempoolConfig.m_mempoolConfig;
+            ASSERT_THAT(mempools.size(), Eq(2U));
+            EXPECT_THAT(mempools[0].m_chunkCacheDepth, Eq(EXPECTED_CHUNK_CACHE_DEPTH));
+            EXPECT_THAT(mempools[1].m_chunkCacheDepth, Eq(0U));
+        })
+        .or_else([](const auto& error) {
+            GTEST_FAIL() << "Expected a config but got error: "
+                         << iox::roudi::ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[static_cast<uint64_t>(error)];
+        });
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingSizeClassLookupAndOverflowPolicyIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b9b7429e-5609-4b9a-8b32-9f4e8cf8294b");
+
+    auto tempFilePath = std::filesystem::temp_directory_path();
+    tempFilePath.append("test_roudi_config_size_class_lookup.toml");
+
+    std::fstream tempFile{tempFilePath, std::ios_base::trunc | std::ios_base::out};
+    ASSERT_TRUE(tempFile.is_open());
+    tempFile << R"([general]
+        version = 1
+
+        [[segment]]
+        size-class-lookup = "linear-search"
+        overflow-to-larger-mempool = true
+
+        [[segment.mempool]]
+        size = 128
+        count = 100
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 100
+    )";
+    tempFile.close();
+
+    cmdLineArgs.configFilePath =
+        iox::roudi::ConfigFilePathString_t(iox::TruncateToCapacity, tempFilePath.u8string().c_str());
+
+    iox::config::TomlRouDiConfigFileProvider sut(cmdLineArgs);
+
+    sut.parse()
+        .and_then([&](const auto& config) {
+            ASSERT_THAT(config.m_sharedMemorySegments.size(), Eq(2U));
+            const auto& configuredSegment = config.m_sharedMemorySegments[0].m_mempoolConfig;
+            EXPECT_THAT(configuredSegment.m_sizeClassLookup, Eq(iox::mepoo::SizeClassLookup::LINEAR_SEARCH));
+            EXPECT_THAT(configuredSegment.m_overflowPolicy,
+                        Eq(iox::mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL));
+            const auto& defaultSegment = config.m_sharedMemorySegments[1].m_mempoolConfig;
+            EXPECT_THAT(defaultSegment.m_sizeClassLookup, Eq(iox::mepoo::SizeClassLookup::BINARY_SEARCH));
+            EXPECT_THAT(defaultSegment.m_overflowPolicy, Eq(iox::mepoo::MemPoolOverflowPolicy::FAIL));
+        })
+        .or_else([](const auto& error) {
+            GTEST_FAIL() << "Expected a config but got error: "
+                         << iox::roudi::ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[static_cast<uint64_t>(error)];
+        });
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingSegmentMemoryOptionsIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e021d36b-6e00-41c2-a88f-bbdce81f0ac9");
+
+    std::istringstream stream(R"([general]
+        version = 1
+
+        [[segment]]
+        prefault = true
+        zeroing-threads = 4
+        transparent-huge-pages = true
+        lock-memory = true
+
+        [[segment.mempool]]
+        size = 128
+        count = 100
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 100
+    )");
+
+    iox::config::TomlRouDiConfigFileProvider::parse(stream)
+        .and_then([&](const auto& config) {
+            ASSERT_THAT(config.m_sharedMemorySegments.size(), Eq(2U));
+            const auto& configuredOptions = config.m_sharedMemorySegments[0].m_mempoolConfig.m_segmentMemoryOptions;
+            EXPECT_TRUE(configuredOptions.m_prefault);
+            EXPECT_THAT(configuredOptions.m_zeroingThreads, Eq(4U));
+            EXPECT_TRUE(configuredOptions.m_transparentHugePages);
+            EXPECT_TRUE(configuredOptions.m_lockMemory);
+            const auto& defaultOptions = config.m_sharedMemorySegments[1].m_mempoolConfig.m_segmentMemoryOptions;
+            EXPECT_FALSE(defaultOptions.m_prefault);
+            EXPECT_THAT(defaultOptions.m_zeroingThreads, Eq(1U));
+            EXPECT_FALSE(defaultOptions.m_transparentHugePages);
+            EXPECT_FALSE(defaultOptions.m_lockMemory);
+        })
+        .or_else([](const auto& error) {
+            GTEST_FAIL() << "Expected a config but got error: "
+                         << iox::roudi::ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[static_cast<uint64_t>(error)];
+        });
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
@@ -181,6 +320,42 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+constexpr const char* CONFIG_INVALID_SIZE_CLASS_LOOKUP = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    size-class-lookup = "lookup-table"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_ZERO_ZEROING_THREADS = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    zeroing-threads = 0
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_TOO_MANY_ZEROING_THREADS = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    zeroing-threads = 65
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -200,6 +375,12 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_SIZE_CLASS_LOOKUP,
+                                 CONFIG_INVALID_SIZE_CLASS_LOOKUP},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMBER_OF_ZEROING_THREADS,
+                                 CONFIG_ZERO_ZEROING_THREADS},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMBER_OF_ZEROING_THREADS,
+                                 CONFIG_TOO_MANY_ZEROING_THREADS},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
@@ -230,7 +230,7 @@ TEST_F(MemPoolIntrospection_test, Send_withSubscribers)
     MemPoolInfo memPoolInfo{0, 0, 0, 0};
     initMemPoolInfoContainer(memPoolInfoContainer);
 
-    EXPECT_CALL(m_segmentManager_mock.m_segmentContainer.front().getMemoryManager(), getMemPoolInfo(_))
+    EXPECT_CALL(m_segmentManager_mock.m_segmentContainer.front().getMemoryManager(), collectMemPoolInfo(_))
         .WillRepeatedly(Invoke([&](uint32_t index) {
             initMemPoolInfo(index, memPoolInfo);
             return memPoolInfo;
@@ -239,7 +239,7 @@ TEST_F(MemPoolIntrospection_test, Send_withSubscribers)
     ChunkMock<Topic> chunk;
     const auto& sample = chunk.sample();
 
-    introspectionAccess.send(); /// @todo iox-#518 expect call to MemPoolHandler::getMemPoolInfo
+    introspectionAccess.send(); /// @todo iox-#518 expect call to MemPoolHandler::collectMemPoolInfo
 
     EXPECT_CALL(m_publisherPortImpl_mock, sendChunk(_)).Times(1);
     ASSERT_EQ(sample->size(), 1u);
@@ -257,7 +257,7 @@ TIMING_TEST_F(MemPoolIntrospection_test, thread, Repeat(5), [&] {
     MemPoolInfo memPoolInfo(0, 0, 0, 0);
     initMemPoolInfoContainer(memPoolInfoContainer);
 
-    EXPECT_CALL(m_rouDiInternalMemoryManager_mock, getMemPoolInfo(_)).WillRepeatedly(Invoke([&](uint32_t index) {
+    EXPECT_CALL(m_rouDiInternalMemoryManager_mock, collectMemPoolInfo(_)).WillRepeatedly(Invoke([&](uint32_t index) {
         initMemPoolInfo(index, memPoolInfo);
         return memPoolInfo;
     }));
@@ -437,6 +437,53 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
     chunk->sample()->~PortIntrospectionFieldTopic();
 }
 
+TEST_F(PortIntrospection_test, sendThroughputDataContainsBlockedDeliveryLatencyHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3d9c0c6-33f1-4f94-a88b-08cf78bcdf69");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+    using iox::popo::LatencyHistogram;
+    using namespace iox::units::duration_literals;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::RuntimeName_t runtimeName{"name1"};
+    iox::capro::ServiceDescription service("1", "2", "3");
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherOptions publisherOptions;
+    iox::popo::PublisherPortData portData(
+        service, runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &memoryManager, publisherOptions);
+
+    auto& histogram = portData.m_chunkSenderData.m_blockedDeliveryLatencyHistogram;
+    histogram.record(500_ns);
+    histogram.record(3_us);
+    histogram.record(3_us);
+
+    EXPECT_THAT(m_introspectionAccess.addPublisher(portData), Eq(true));
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+
+    const auto& throughputData = chunk->sample()->m_throughputList[0];
+    for (uint32_t i = 0U; i < LatencyHistogram::NUMBER_OF_BUCKETS; ++i)
+    {
+        EXPECT_THAT(throughputData.m_blockedDeliveryLatencyHistogram[i], Eq(histogram.count(i)));
+    }
+    EXPECT_THAT(throughputData.m_blockedDeliveryLatencyHistogram[LatencyHistogram::bucketIndex(500_ns)], Eq(1U));
+    EXPECT_THAT(throughputData.m_blockedDeliveryLatencyHistogram[LatencyHistogram::bucketIndex(3_us)], Eq(2U));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
 
 TEST_F(PortIntrospection_test, Thread)
 {
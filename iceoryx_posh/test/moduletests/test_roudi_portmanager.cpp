@@ -154,6 +154,37 @@ TEST_F(PortManager_test, DoDiscoveryWithSubscribersCreatedBeforeAndAfterCreation
     EXPECT_THAT(subscriber2.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, DoDiscoveryIgnoresPortStateChangesWithoutDiscoveryRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a4f2319-43ee-4cb4-921d-5f4df2e63f4e");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    ASSERT_TRUE(subscriber);
+    subscriber.subscribe();
+
+    auto publisherPortData =
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    PublisherPortUser publisher(publisherPortData);
+    m_portManager->doDiscovery();
+
+    // bypass the user API to change the port state without requesting a discovery
+    publisherPortData->m_offeringRequested.store(true, std::memory_order_relaxed);
+    m_portManager->doDiscovery();
+    EXPECT_FALSE(publisher.hasSubscribers());
+
+    BasePort(publisherPortData).requestDiscovery();
+    m_portManager->doDiscovery();
+    EXPECT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
 TEST_F(PortManager_test, SubscribeOnCreateSubscribesWithoutDiscoveryLoopWhenPublisherAvailable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5a94cf82-d1f6-4129-88ca-34344d94e04e");
@@ -78,6 +78,8 @@ class PortManager_test : public Test
     vector<iox::capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const capro::ServiceDescription serviceRegistry{
         SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME};
+    const capro::ServiceDescription serviceRegistryDelta{
+        SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME};
 
     void SetUp() override
     {
@@ -111,6 +113,7 @@ class PortManager_test : public Test
     void addInternalPublisherOfPortManagerToVector()
     {
         internalServices.push_back(serviceRegistry);
+        internalServices.push_back(serviceRegistryDelta);
         internalServices.push_back(IntrospectionPortService);
         internalServices.push_back(IntrospectionPortThroughputService);
         internalServices.push_back(IntrospectionSubscriberPortChangingDataService);
@@ -746,4 +746,182 @@ TYPED_TEST(ServiceRegistry_test, HasDataChangedSinceLastCallReturnsTrueAfterRemo
     EXPECT_TRUE(this->sut.registry.hasDataChangedSinceLastCall());
 }
 
+TYPED_TEST(ServiceRegistry_test, FindWithPartialWildcardsReturnsEntriesInRegistryOrderAfterSlotReuse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fc5eca88-5e0e-43e0-a469-41a799559906");
+    iox::capro::ServiceDescription service1("a", "1", "x");
+    iox::capro::ServiceDescription service2("a", "2", "y");
+    iox::capro::ServiceDescription service3("a", "3", "x");
+    iox::capro::ServiceDescription service4("a", "4", "y");
+
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+    ASSERT_FALSE(this->sut.add(service3).has_error());
+    this->sut.remove(service1);
+    // reuses the slot of the removed service
+    ASSERT_FALSE(this->sut.add(service4).has_error());
+
+    SearchResult_t allEntries;
+    this->sut->forEach([&](const auto& entry) { allEntries.push_back(entry); });
+    this->find(iox::capro::IdString_t("a"), iox::capro::Wildcard, iox::capro::Wildcard);
+
+    ASSERT_THAT(this->searchResult.size(), Eq(3U));
+    ASSERT_THAT(allEntries.size(), Eq(3U));
+    for (uint64_t i = 0U; i < allEntries.size(); ++i)
+    {
+        EXPECT_THAT(this->searchResult[i].serviceDescription, Eq(allEntries[i].serviceDescription));
+    }
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(service4));
+
+    this->find(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::IdString_t("y"));
+    ASSERT_THAT(this->searchResult.size(), Eq(2U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(service4));
+    EXPECT_THAT(this->searchResult[1].serviceDescription, Eq(service2));
+}
+
+TYPED_TEST(ServiceRegistry_test, FindResultsMatchLinearSearchAfterManyAddsAndRemovals)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "684058a9-5927-4441-a40f-35b3e307e0be");
+    constexpr uint64_t NUMBER_OF_ID_STRINGS{4U};
+    std::vector<IdString_t> ids;
+    for (uint64_t i = 0U; i < NUMBER_OF_ID_STRINGS; ++i)
+    {
+        ids.emplace_back(iox::TruncateToCapacity, std::to_string(i).c_str());
+    }
+
+    auto randomDescription = [&] {
+        return ServiceDescription(ids[uniform(NUMBER_OF_ID_STRINGS - 1U)],
+                                  ids[uniform(NUMBER_OF_ID_STRINGS - 1U)],
+                                  ids[uniform(NUMBER_OF_ID_STRINGS - 1U)]);
+    };
+
+    for (uint64_t i = 0U; i < 1000U; ++i)
+    {
+        if (uniform(2U) == 0U)
+        {
+            this->sut.remove(randomDescription());
+        }
+        else
+        {
+            ASSERT_FALSE(this->sut.add(randomDescription()).has_error());
+        }
+    }
+
+    std::vector<optional<IdString_t>> searchValues{iox::capro::Wildcard};
+    searchValues.insert(searchValues.end(), ids.begin(), ids.end());
+    for (const auto& service : searchValues)
+    {
+        for (const auto& instance : searchValues)
+        {
+            for (const auto& event : searchValues)
+            {
+                SearchResult_t expectedResult;
+                this->sut->forEach([&](const auto& entry) {
+                    const auto& sd = entry.serviceDescription;
+                    if ((!service || sd.getServiceIDString() == *service)
+                        && (!instance || sd.getInstanceIDString() == *instance)
+                        && (!event || sd.getEventIDString() == *event))
+                    {
+                        expectedResult.push_back(entry);
+                    }
+                });
+
+                this->find(service, instance, event);
+                ASSERT_THAT(this->searchResult.size(), Eq(expectedResult.size()));
+                for (uint64_t i = 0U; i < expectedResult.size(); ++i)
+                {
+                    EXPECT_THAT(this->searchResult[i].serviceDescription, Eq(expectedResult[i].serviceDescription));
+                    EXPECT_THAT(this->sut.count(this->searchResult[i]), Eq(this->sut.count(expectedResult[i])));
+                }
+            }
+        }
+    }
+}
+
+TYPED_TEST(ServiceRegistry_test, ApplyDeltaWithMismatchingBaseVersionFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b75972d1-53f0-4d75-8841-5c446d3628ee");
+    ServiceRegistry::Delta delta;
+    delta.baseVersion = 1U;
+    delta.version = 2U;
+    delta.changes.emplace_back(ServiceDescription("Tiramisu", "Mascarpone", "Espresso"));
+    delta.changes.back().publisherCount = 1U;
+
+    EXPECT_FALSE(this->sut->applyDelta(delta));
+
+    EXPECT_THAT(this->sut->version(), Eq(0U));
+    EXPECT_THAT(this->countServices(), Eq(0U));
+}
+
+TYPED_TEST(ServiceRegistry_test, IncrementVersionIncreasesVersionByOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2fe1df8-f639-4ec7-92b5-b77a1a62493e");
+    EXPECT_THAT(this->sut->version(), Eq(0U));
+
+    this->sut->incrementVersion();
+    this->sut->incrementVersion();
+
+    EXPECT_THAT(this->sut->version(), Eq(2U));
+}
+
+TYPED_TEST(ServiceRegistry_test, ApplyingDeltasOfChangedEntriesReproducesTheRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aaaec2ac-29ea-435e-932e-eda8c4e8d084");
+    const ServiceDescription sd1("Cake", "Chocolate", "Cherry");
+    const ServiceDescription sd2("Cake", "Chocolate", "Banana");
+    const ServiceDescription sd3("Cake", "Vanilla", "Cherry");
+    ASSERT_FALSE(this->sut.add(sd1).has_error());
+    ASSERT_FALSE(this->sut.add(sd1).has_error());
+    ASSERT_FALSE(this->sut.add(sd2).has_error());
+    ASSERT_FALSE(this->sut.otherAdd(sd3).has_error());
+
+    auto createDelta = [&](const uint64_t baseVersion, const std::vector<ServiceDescription>& changedServices) {
+        ServiceRegistry::Delta delta;
+        delta.baseVersion = baseVersion;
+        delta.version = baseVersion + 1U;
+        for (const auto& service : changedServices)
+        {
+            delta.changes.emplace_back(service);
+            this->sut->find(service.getServiceIDString(),
+                            service.getInstanceIDString(),
+                            service.getEventIDString(),
+                            [&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+                                delta.changes.back() = entry;
+                            });
+        }
+        return delta;
+    };
+
+    auto expectEqualEntries = [&](const ServiceRegistry& registry) {
+        uint64_t numberOfEntries{0U};
+        registry.forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+            ++numberOfEntries;
+            bool isFound{false};
+            this->sut->find(entry.serviceDescription.getServiceIDString(),
+                            entry.serviceDescription.getInstanceIDString(),
+                            entry.serviceDescription.getEventIDString(),
+                            [&](const ServiceRegistry::ServiceDescriptionEntry& expectedEntry) {
+                                isFound = true;
+                                EXPECT_THAT(entry.publisherCount, Eq(expectedEntry.publisherCount));
+                                EXPECT_THAT(entry.serverCount, Eq(expectedEntry.serverCount));
+                            });
+            EXPECT_TRUE(isFound);
+        });
+        EXPECT_THAT(numberOfEntries, Eq(this->countServices()));
+    };
+
+    ServiceRegistry registry;
+    ASSERT_TRUE(registry.applyDelta(createDelta(0U, {sd1, sd2, sd3})));
+    EXPECT_THAT(registry.version(), Eq(1U));
+    expectEqualEntries(registry);
+
+    this->sut.remove(sd1);
+    this->sut.remove(sd2);
+    ASSERT_FALSE(this->sut.otherAdd(sd1).has_error());
+
+    ASSERT_TRUE(registry.applyDelta(createDelta(1U, {sd1, sd2})));
+    EXPECT_THAT(registry.version(), Eq(2U));
+    expectEqualEntries(registry);
+}
+
 } // namespace
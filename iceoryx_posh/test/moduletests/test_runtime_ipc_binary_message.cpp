@@ -0,0 +1,382 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+
+class IpcBinaryMessage_test : public Test
+{
+  public:
+    IpcBinaryMessage transfer(const IpcBinaryMessage& message)
+    {
+        IpcBinaryMessage::Frame_t frame;
+        EXPECT_TRUE(message.encode(frame));
+        IpcBinaryMessage received;
+        EXPECT_TRUE(received.decode(frame));
+        return received;
+    }
+};
+
+TEST_F(IpcBinaryMessage_test, DefaultConstructedMessageIsInvalid)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "508a9ec8-2669-42c2-bc16-71923df78a74");
+    IpcBinaryMessage sut;
+
+    EXPECT_FALSE(sut.isValid());
+    EXPECT_THAT(sut.getMessageType(), Eq(IpcMessageType::NOTYPE));
+
+    IpcBinaryMessage::Frame_t frame;
+    EXPECT_FALSE(sut.encode(frame));
+}
+
+TEST_F(IpcBinaryMessage_test, MessageWithTypeIsValidAndContainsOnlyTheHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "747d9baf-fc54-4c63-bfe9-f8cd57c0b3d0");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+
+    EXPECT_TRUE(sut.isValid());
+    EXPECT_THAT(sut.getMessageType(), Eq(IpcMessageType::CREATE_PUBLISHER));
+    EXPECT_THAT(sut.size(), Eq(IpcBinaryMessage::HEADER_SIZE));
+    EXPECT_TRUE(sut.isFullyExtracted());
+}
+
+TEST_F(IpcBinaryMessage_test, ArithmeticAndEnumEntriesCanBeExtractedAfterTransfer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "74338497-3e59-4622-8558-071992a64290");
+    constexpr uint64_t OFFSET{0xFF00000000000001ULL};
+    constexpr int64_t TIMESTAMP{-42};
+    IpcBinaryMessage message{IpcMessageType::CREATE_PUBLISHER_ACK};
+    message << OFFSET << TIMESTAMP << true << IpcMessageErrorType::PUBLISHER_LIST_FULL;
+
+    auto sut = transfer(message);
+
+    uint64_t offset{0U};
+    int64_t timestamp{0};
+    bool flag{false};
+    IpcMessageErrorType error{IpcMessageErrorType::NOTYPE};
+    sut >> offset >> timestamp >> flag >> error;
+
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(sut.getMessageType(), Eq(IpcMessageType::CREATE_PUBLISHER_ACK));
+    EXPECT_THAT(offset, Eq(OFFSET));
+    EXPECT_THAT(timestamp, Eq(TIMESTAMP));
+    EXPECT_TRUE(flag);
+    EXPECT_THAT(error, Eq(IpcMessageErrorType::PUBLISHER_LIST_FULL));
+    EXPECT_TRUE(sut.isFullyExtracted());
+}
+
+TEST_F(IpcBinaryMessage_test, StringEntriesCanBeExtractedAfterTransfer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4ab636eb-b5b4-4e2d-a31d-111d1704990c");
+    const RuntimeName_t runtimeName{"hypnotoad, the one and only"};
+    const RuntimeName_t emptyName{""};
+    IpcBinaryMessage message{IpcMessageType::REG};
+    message << runtimeName << emptyName;
+
+    auto sut = transfer(message);
+
+    RuntimeName_t extractedName;
+    RuntimeName_t extractedEmptyName{"not empty"};
+    sut >> extractedName >> extractedEmptyName;
+
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(extractedName, Eq(runtimeName));
+    EXPECT_TRUE(extractedEmptyName.empty());
+}
+
+TEST_F(IpcBinaryMessage_test, ExtractingBeyondTheEntriesInvalidatesTheMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7fe7339a-4016-451f-a912-2bd37d0228c6");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER_ACK};
+    sut << uint32_t{13U};
+
+    uint64_t value{37U};
+    sut >> value;
+
+    EXPECT_FALSE(sut.isValid());
+    EXPECT_THAT(value, Eq(37U));
+}
+
+TEST_F(IpcBinaryMessage_test, ExtractingStringWhichExceedsTheCapacityInvalidatesTheMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9b58f49-f245-4daa-93c7-438241129bac");
+    IpcBinaryMessage sut{IpcMessageType::REG};
+    sut << string<10>{"ThisIsLong"};
+
+    string<5> value;
+    sut >> value;
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryMessage_test, AddingMoreThanTheMaxPayloadSizeInvalidatesTheMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f360ba82-bf47-4b48-81ef-0ef8f7d7515f");
+    IpcBinaryMessage sut{IpcMessageType::REG};
+    for (uint64_t i = IpcBinaryMessage::HEADER_SIZE; i < IpcBinaryMessage::MAX_PAYLOAD_SIZE; ++i)
+    {
+        sut << uint8_t{0U};
+    }
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(sut.size(), Eq(IpcBinaryMessage::MAX_PAYLOAD_SIZE));
+
+    sut << uint8_t{0U};
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryMessage_test, EncodedFrameStartsWithMarkerAndFitsIntoTheChannelForAnyPayload)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "827d158b-0341-4157-a4c2-5bb9b63e2f0f");
+    for (const uint8_t fill : {uint8_t{0U}, uint8_t{1U}, uint8_t{0xFFU}})
+    {
+        IpcBinaryMessage message{IpcMessageType::REG};
+        for (uint64_t i = IpcBinaryMessage::HEADER_SIZE; i < IpcBinaryMessage::MAX_PAYLOAD_SIZE; ++i)
+        {
+            message << fill;
+        }
+
+        IpcBinaryMessage::Frame_t frame;
+        ASSERT_TRUE(message.encode(frame));
+        EXPECT_TRUE(IpcBinaryMessage::isFrame(frame));
+        EXPECT_THAT(frame.size(), Le(IpcBinaryMessage::MAX_FRAME_SIZE));
+
+        IpcBinaryMessage sut;
+        ASSERT_TRUE(sut.decode(frame));
+        EXPECT_THAT(sut.size(), Eq(IpcBinaryMessage::MAX_PAYLOAD_SIZE));
+        for (uint64_t i = IpcBinaryMessage::HEADER_SIZE; i < IpcBinaryMessage::MAX_PAYLOAD_SIZE; ++i)
+        {
+            uint8_t value{42U};
+            sut >> value;
+            ASSERT_THAT(value, Eq(fill));
+        }
+        EXPECT_TRUE(sut.isValid());
+    }
+}
+
+TEST_F(IpcBinaryMessage_test, DecodingATextMessageFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66bd3fa3-ca27-4d3d-adb1-4620b78cd696");
+    const IpcBinaryMessage::Frame_t textMessage{"3,hypnotoad,"};
+
+    IpcBinaryMessage sut;
+
+    EXPECT_FALSE(IpcBinaryMessage::isFrame(textMessage));
+    EXPECT_FALSE(sut.decode(textMessage));
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryMessage_test, DecodingAFrameWithACodeBeyondTheEndFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6258288a-eee2-4954-9574-511aa8c58ba9");
+    IpcBinaryMessage message{IpcMessageType::REG};
+    IpcBinaryMessage::Frame_t frame;
+    ASSERT_TRUE(message.encode(frame));
+
+    IpcBinaryMessage::Frame_t truncatedFrame{TruncateToCapacity, frame.c_str(), frame.size() - 1U};
+    IpcBinaryMessage sut;
+
+    EXPECT_FALSE(sut.decode(truncatedFrame));
+}
+
+TEST_F(IpcBinaryMessage_test, DecodingAFrameWithAnotherProtocolVersionFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1546e170-a50b-4a65-8928-1ff9c0b2ff1a");
+    IpcBinaryMessage message{IpcMessageType::REG};
+    IpcBinaryMessage::Frame_t frame;
+    ASSERT_TRUE(message.encode(frame));
+
+    // the first data byte after the frame marker and the first code byte is the protocol version
+    frame.unsafe_raw_access([](char* str, const auto info) -> uint64_t {
+        str[2] = static_cast<char>(IpcBinaryMessage::PROTOCOL_VERSION + 1U);
+        return info.used_size;
+    });
+    IpcBinaryMessage sut;
+
+    EXPECT_FALSE(sut.decode(frame));
+}
+
+TEST_F(IpcBinaryMessage_test, ServiceDescriptionCanBeTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2dcdcb6a-e25c-4f5d-a4c6-4ae434098214");
+    capro::ServiceDescription service{
+        "Radar", "FrontLeft", "Objects", {1U, 2U, 3U, 0xFFFFFFFFU}, capro::Interfaces::SOMEIP};
+    service.setLocal();
+    IpcBinaryMessage message{IpcMessageType::CREATE_PUBLISHER};
+    message << service;
+
+    auto sut = transfer(message);
+
+    capro::ServiceDescription extractedService;
+    sut >> extractedService;
+
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(extractedService, Eq(service));
+    EXPECT_THAT(extractedService.getClassHash(), Eq(service.getClassHash()));
+    EXPECT_THAT(extractedService.getSourceInterface(), Eq(capro::Interfaces::SOMEIP));
+    EXPECT_TRUE(extractedService.isLocal());
+}
+
+TEST_F(IpcBinaryMessage_test, ServiceDescriptionWithInvalidInterfaceInvalidatesTheMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d9069c96-ceac-46ec-a4db-1031cafe234c");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+    sut << capro::IdString_t{"a"} << capro::IdString_t{"b"} << capro::IdString_t{"c"} << uint32_t{0U} << uint32_t{0U}
+        << uint32_t{0U} << uint32_t{0U} << capro::Scope::WORLDWIDE << capro::Interfaces::INTERFACE_END;
+
+    capro::ServiceDescription service;
+    sut >> service;
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryMessage_test, PublisherOptionsCanBeTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "89efaa19-111e-4f50-835b-89d65c71e781");
+    popo::PublisherOptions options;
+    options.historyCapacity = 7U;
+    options.nodeName = "node";
+    options.offerOnCreate = false;
+    options.subscriberTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    options.deliveryMode = popo::QueueDeliveryMode::LOCK_FREE_SNAPSHOT;
+    IpcBinaryMessage message{IpcMessageType::CREATE_PUBLISHER};
+    message << options;
+
+    auto sut = transfer(message);
+
+    popo::PublisherOptions extractedOptions;
+    sut >> extractedOptions;
+
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(extractedOptions.historyCapacity, Eq(options.historyCapacity));
+    EXPECT_THAT(extractedOptions.nodeName, Eq(options.nodeName));
+    EXPECT_THAT(extractedOptions.offerOnCreate, Eq(options.offerOnCreate));
+    EXPECT_THAT(extractedOptions.subscriberTooSlowPolicy, Eq(options.subscriberTooSlowPolicy));
+    EXPECT_THAT(extractedOptions.deliveryMode, Eq(options.deliveryMode));
+}
+
+TEST_F(IpcBinaryMessage_test, PublisherOptionsWithInvalidPolicyInvalidatesTheMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ebd07bf1-d27a-4cc5-9074-d6080dc8afaa");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+    sut << uint64_t{0U} << NodeName_t{"node"} << true << uint8_t{111U} << uint8_t{0U};
+
+    popo::PublisherOptions options;
+    sut >> options;
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST_F(IpcBinaryMessage_test, SubscriberOptionsCanBeTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f8d9780-e0a6-42b4-ade4-5ec88afdedf5");
+    popo::SubscriberOptions options;
+    options.queueCapacity = 11U;
+    options.historyRequest = 3U;
+    options.nodeName = "node";
+    options.subscribeOnCreate = false;
+    options.queueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    options.requiresPublisherHistorySupport = true;
+    IpcBinaryMessage message{IpcMessageType::CREATE_SUBSCRIBER};
+    message << options;
+
+    auto sut = transfer(message);
+
+    popo::SubscriberOptions extractedOptions;
+    sut >> extractedOptions;
+
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(extractedOptions.queueCapacity, Eq(options.queueCapacity));
+    EXPECT_THAT(extractedOptions.historyRequest, Eq(options.historyRequest));
+    EXPECT_THAT(extractedOptions.nodeName, Eq(options.nodeName));
+    EXPECT_THAT(extractedOptions.subscribeOnCreate, Eq(options.subscribeOnCreate));
+    EXPECT_THAT(extractedOptions.queueFullPolicy, Eq(options.queueFullPolicy));
+    EXPECT_THAT(extractedOptions.requiresPublisherHistorySupport, Eq(options.requiresPublisherHistorySupport));
+}
+
+TEST_F(IpcBinaryMessage_test, ClientOptionsCanBeTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf93c8f5-0bdb-4915-8ed8-10bf275b9d2f");
+    popo::ClientOptions options;
+    options.responseQueueCapacity = 13U;
+    options.nodeName = "node";
+    options.connectOnCreate = false;
+    options.responseQueueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    options.serverTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    IpcBinaryMessage message{IpcMessageType::CREATE_CLIENT};
+    message << options;
+
+    auto sut = transfer(message);
+
+    popo::ClientOptions extractedOptions;
+    sut >> extractedOptions;
+
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(extractedOptions, Eq(options));
+}
+
+TEST_F(IpcBinaryMessage_test, ServerOptionsCanBeTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a21a278a-48b3-4f64-8612-3e32021dd9ce");
+    popo::ServerOptions options;
+    options.requestQueueCapacity = 17U;
+    options.nodeName = "node";
+    options.offerOnCreate = false;
+    options.requestQueueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    options.clientTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    IpcBinaryMessage message{IpcMessageType::CREATE_SERVER};
+    message << options;
+
+    auto sut = transfer(message);
+
+    popo::ServerOptions extractedOptions;
+    sut >> extractedOptions;
+
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(extractedOptions, Eq(options));
+}
+
+TEST_F(IpcBinaryMessage_test, PortConfigInfoCanBeTransferred)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f61bed6f-2342-4c08-9e98-8acbdc1e58a0");
+    const PortConfigInfo portConfigInfo{1U, 2U, 3U};
+    IpcBinaryMessage message{IpcMessageType::CREATE_PUBLISHER};
+    message << portConfigInfo;
+
+    auto sut = transfer(message);
+
+    PortConfigInfo extractedPortConfigInfo;
+    sut >> extractedPortConfigInfo;
+
+    ASSERT_TRUE(sut.isValid());
+    EXPECT_THAT(extractedPortConfigInfo, Eq(portConfigInfo));
+}
+
+} // namespace
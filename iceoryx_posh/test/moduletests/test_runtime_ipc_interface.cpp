@@ -280,6 +280,58 @@ TYPED_TEST(IpcInterface_test, SendMoreThanAllowedLeadsToError)
     EXPECT_EQ(shortMessage, receivedMessage);
 }
 
+TYPED_TEST(IpcInterface_test, SendAndReceiveBinaryMessageWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a843d4e9-2be4-44b7-a768-d5c5a4ff7c10");
+    constexpr uint64_t OFFSET{0x0100U};
+    constexpr uint64_t SEGMENT_ID{0U};
+
+    runtime::IpcBinaryMessage message{runtime::IpcMessageType::CREATE_PUBLISHER_ACK};
+    message << OFFSET << SEGMENT_ID;
+    ASSERT_TRUE(this->client->send(message));
+
+    runtime::IpcBinaryMessage receivedMessage;
+    ASSERT_TRUE(this->server->receive(receivedMessage));
+    ASSERT_TRUE(receivedMessage.isValid());
+    EXPECT_THAT(receivedMessage.getMessageType(), Eq(runtime::IpcMessageType::CREATE_PUBLISHER_ACK));
+
+    uint64_t offset{0U};
+    uint64_t segmentId{1U};
+    receivedMessage >> offset >> segmentId;
+    EXPECT_TRUE(receivedMessage.isValid());
+    EXPECT_TRUE(receivedMessage.isFullyExtracted());
+    EXPECT_THAT(offset, Eq(OFFSET));
+    EXPECT_THAT(segmentId, Eq(SEGMENT_ID));
+}
+
+TYPED_TEST(IpcInterface_test, TimedReceiveDistinguishesTextAndBinaryMessages)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "810f5adf-004f-454f-b300-5fbd74c96858");
+    using namespace iox::units;
+    Duration timeout = 100_ms;
+
+    runtime::IpcMessage textMessage;
+    textMessage << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG) << "hypnotoad";
+    ASSERT_TRUE(this->client->send(textMessage));
+
+    runtime::IpcBinaryMessage binaryMessage{runtime::IpcMessageType::CREATE_CONDITION_VARIABLE};
+    binaryMessage << RuntimeName_t("hypnotoad");
+    ASSERT_TRUE(this->client->send(binaryMessage));
+
+    runtime::IpcMessage receivedTextMessage;
+    runtime::IpcBinaryMessage receivedBinaryMessage;
+    ASSERT_TRUE(this->server->timedReceive(timeout, receivedTextMessage, receivedBinaryMessage));
+    EXPECT_FALSE(receivedBinaryMessage.isValid());
+    EXPECT_EQ(receivedTextMessage, textMessage);
+
+    ASSERT_TRUE(this->server->timedReceive(timeout, receivedTextMessage, receivedBinaryMessage));
+    ASSERT_TRUE(receivedBinaryMessage.isValid());
+    EXPECT_THAT(receivedBinaryMessage.getMessageType(), Eq(runtime::IpcMessageType::CREATE_CONDITION_VARIABLE));
+    RuntimeName_t runtimeName;
+    receivedBinaryMessage >> runtimeName;
+    EXPECT_THAT(runtimeName.c_str(), StrEq("hypnotoad"));
+}
+
 /// @todo iox-#1623 Check if blocking send is supported on all platforms
 #if !(defined(__APPLE__) || defined(unix) || defined(__unix) || defined(__unix__))
 TYPED_TEST(IpcInterface_test, TimedSendWorks)
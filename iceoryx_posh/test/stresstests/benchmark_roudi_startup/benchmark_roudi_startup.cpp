@@ -0,0 +1,120 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iox/atomic.hpp"
+#include "iox/detail/convert.hpp"
+#include "iox/logging.hpp"
+#include "iox/optional.hpp"
+#include "iox/std_string_support.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+using namespace iox::units::duration_literals;
+
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIMES{100U};
+constexpr units::Duration REGISTRATION_TIMEOUT{60_s};
+
+/// @brief Starts the given number of runtimes at the same time and measures the duration until all of them are
+/// registered at RouDi
+/// @return the duration in milliseconds or nullopt if not all runtimes could register
+optional<uint64_t> measureRegistrationOfRuntimes(const uint32_t numberOfRuntimes,
+                                                 const uint32_t runtimeMessagesThreadCount)
+{
+    auto config = roudi_env::MinimalIceoryxConfigBuilder().create();
+    config.runtimeMessagesThreadCount = runtimeMessagesThreadCount;
+    roudi_env::RouDiEnv roudi{config};
+
+    // the runtimes are kept alive until all of them are registered, like it is the case at a system startup
+    std::vector<optional<runtime::IpcRuntimeInterface>> runtimes(numberOfRuntimes);
+    concurrent::Atomic<bool> start{false};
+    concurrent::Atomic<uint32_t> numberOfRegisteredRuntimes{0U};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < numberOfRuntimes; ++i)
+    {
+        threads.emplace_back([&, i] {
+            const auto name = into<lossy<RuntimeName_t>>("iox-bm-runtime-" + std::to_string(i));
+            while (!start.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+            runtime::IpcRuntimeInterface::create(name, DEFAULT_DOMAIN_ID, REGISTRATION_TIMEOUT)
+                .and_then([&](auto& runtime) {
+                    runtimes[i].emplace(std::move(runtime));
+                    ++numberOfRegisteredRuntimes;
+                });
+        });
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    auto duration = std::chrono::steady_clock::now() - startTime;
+
+    if (numberOfRegisteredRuntimes.load() != numberOfRuntimes)
+    {
+        return nullopt;
+    }
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t numberOfRuntimes{DEFAULT_NUMBER_OF_RUNTIMES};
+    if (argc > 1)
+    {
+        auto maybeNumber = convert::from_string<uint32_t>(argv[1]);
+        if (!maybeNumber.has_value() || maybeNumber.value() == 0U || maybeNumber.value() > MAX_PROCESS_NUMBER)
+        {
+            std::cout << "Usage: " << argv[0] << " [number of runtimes, 1.." << MAX_PROCESS_NUMBER << "]"
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+        numberOfRuntimes = maybeNumber.value();
+    }
+
+    iox::log::Logger::setLogLevel(iox::log::LogLevel::Warn);
+
+    for (const uint32_t threadCount : {1U, 2U, 4U, roudi::MAX_RUNTIME_MESSAGES_THREADS})
+    {
+        auto durationMilliseconds = measureRegistrationOfRuntimes(numberOfRuntimes, threadCount);
+        // Not using iceoryx logger due to width requirements
+        std::cout << std::setw(3) << threadCount << " runtime message threads : " << std::setw(4) << numberOfRuntimes
+                  << " runtimes : ";
+        if (durationMilliseconds.has_value())
+        {
+            std::cout << std::setw(6) << durationMilliseconds.value() << " ms" << std::endl;
+        }
+        else
+        {
+            std::cout << "registration failed" << std::endl;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
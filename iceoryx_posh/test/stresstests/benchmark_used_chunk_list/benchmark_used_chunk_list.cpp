@@ -0,0 +1,112 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint32_t NUMBER_OF_HELD_SAMPLES{256U};
+constexpr uint32_t NUMBER_OF_ROUNDS{20000U};
+constexpr uint64_t CHUNK_SIZE{128U};
+constexpr uint64_t MEMORY_SIZE{4U << 20U};
+
+enum class ReleaseOrder
+{
+    NEWEST_FIRST,
+    OLDEST_FIRST,
+    RANDOM
+};
+
+/// @brief Fills a UsedChunkList with NUMBER_OF_HELD_SAMPLES chunks, like a subscriber which holds the maximum number
+/// of samples, and releases all of them in the given order
+/// @return the average duration of one release in nanoseconds
+uint64_t measureRelease(mepoo::MemoryManager& memoryManager, const ReleaseOrder releaseOrder)
+{
+    popo::UsedChunkList<NUMBER_OF_HELD_SAMPLES> usedChunkList;
+    auto chunkSettings =
+        mepoo::ChunkSettings::create(sizeof(uint64_t), CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).expect("Valid settings");
+
+    std::mt19937 randomGenerator{42U};
+    std::vector<uint32_t> order(NUMBER_OF_HELD_SAMPLES);
+    std::vector<mepoo::ChunkHeader*> chunkHeaders(NUMBER_OF_HELD_SAMPLES);
+    std::chrono::nanoseconds duration{0};
+    for (uint32_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        for (auto& chunkHeader : chunkHeaders)
+        {
+            auto chunk = memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
+            chunkHeader = chunk.getChunkHeader();
+            usedChunkList.insert(chunk);
+        }
+
+        std::iota(order.begin(), order.end(), 0U);
+        if (releaseOrder == ReleaseOrder::NEWEST_FIRST)
+        {
+            std::reverse(order.begin(), order.end());
+        }
+        else if (releaseOrder == ReleaseOrder::RANDOM)
+        {
+            std::shuffle(order.begin(), order.end(), randomGenerator);
+        }
+
+        // the chunks are returned to the mempool after the measurement to time only the list operations
+        std::vector<mepoo::SharedChunk> removedChunks(NUMBER_OF_HELD_SAMPLES);
+        auto startTime = std::chrono::steady_clock::now();
+        for (uint32_t i = 0U; i < NUMBER_OF_HELD_SAMPLES; ++i)
+        {
+            usedChunkList.remove(chunkHeaders[order[i]], removedChunks[i]);
+        }
+        duration += std::chrono::steady_clock::now() - startTime;
+    }
+
+    return static_cast<uint64_t>(duration.count()) / (static_cast<uint64_t>(NUMBER_OF_ROUNDS) * NUMBER_OF_HELD_SAMPLES);
+}
+
+int main()
+{
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({CHUNK_SIZE, NUMBER_OF_HELD_SAMPLES});
+
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[MEMORY_SIZE]};
+    BumpAllocator memoryAllocator{memory.get(), MEMORY_SIZE};
+    mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolConfig, memoryAllocator, memoryAllocator);
+
+    for (const auto releaseOrder : {ReleaseOrder::NEWEST_FIRST, ReleaseOrder::OLDEST_FIRST, ReleaseOrder::RANDOM})
+    {
+        const std::string orderName = (releaseOrder == ReleaseOrder::NEWEST_FIRST)   ? "newest first"
+                                      : (releaseOrder == ReleaseOrder::OLDEST_FIRST) ? "oldest first"
+                                                                                     : "random order";
+        // Not using iceoryx logger due to width requirements
+        std::cout << std::setw(4) << NUMBER_OF_HELD_SAMPLES << " held samples released " << orderName << " : "
+                  << std::setw(6) << measureRelease(memoryManager, releaseOrder) << " (nanosecs/release)" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
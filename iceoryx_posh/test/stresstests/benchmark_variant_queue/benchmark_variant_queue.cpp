@@ -0,0 +1,101 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t QUEUE_CAPACITY{256U};
+constexpr uint64_t NUMBER_OF_VALUES_PER_PUBLISHER{1000000U};
+
+/// @brief Lets the given number of publisher threads push concurrently into one queue, like multiple publishers
+/// delivering to one subscriber, while a single consumer thread pops all values
+/// @return the average duration per transferred value in nanoseconds
+uint64_t measureFanIn(const popo::VariantQueueTypes queueType, const uint32_t numberOfPublishers)
+{
+    auto queue = std::make_unique<popo::VariantQueue<uint64_t, QUEUE_CAPACITY>>(queueType);
+    const uint64_t numberOfValues = NUMBER_OF_VALUES_PER_PUBLISHER * numberOfPublishers;
+
+    std::atomic_bool start{false};
+    std::vector<std::thread> publishers;
+    for (uint32_t i = 0U; i < numberOfPublishers; ++i)
+    {
+        publishers.emplace_back([&] {
+            while (!start.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+            for (uint64_t value = 0U; value < NUMBER_OF_VALUES_PER_PUBLISHER; ++value)
+            {
+                // the queue rejects the value when it is full, retry until the consumer made room
+                while (queue->push(value).has_value())
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    uint64_t numberOfReceivedValues{0U};
+    auto startTime = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    while (numberOfReceivedValues < numberOfValues)
+    {
+        if (queue->pop().has_value())
+        {
+            ++numberOfReceivedValues;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    auto duration = std::chrono::steady_clock::now() - startTime;
+
+    for (auto& publisher : publishers)
+    {
+        publisher.join();
+    }
+
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count())
+           / numberOfValues;
+}
+
+int main()
+{
+    for (const uint32_t numberOfPublishers : {1U, 2U, 4U})
+    {
+        for (const auto queueType : {popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                     popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer_FixedCapacity})
+        {
+            const std::string queueName =
+                (queueType == popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer) ? "resizable" : "fixed    ";
+            // Not using iceoryx logger due to width requirements
+            std::cout << numberOfPublishers << " publisher(s), " << queueName << " queue : " << std::setw(6)
+                      << measureFanIn(queueType, numberOfPublishers) << " (nanosecs/value)" << std::endl;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -312,6 +312,8 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     constexpr int32_t usedchunksWidth{14};
     constexpr int32_t numchunksWidth{9};
     constexpr int32_t minFreechunksWidth{9};
+    constexpr int32_t maxUsedchunksWidth{9};
+    constexpr int32_t allocationFailuresWidth{9};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
 
@@ -319,9 +321,11 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
+    wprintw(pad, "%*s |", maxUsedchunksWidth, "Max Used");
+    wprintw(pad, "%*s |", allocationFailuresWidth, "Failures");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
     wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad, "-------------------------------------------------------------------------------------------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -332,6 +336,8 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*u |", usedchunksWidth, info.m_usedChunks);
             wprintw(pad, "%*u |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*u |", minFreechunksWidth, info.m_minFreeChunks);
+            wprintw(pad, "%*u |", maxUsedchunksWidth, info.m_maxUsedChunksInInterval);
+            wprintw(pad, FORMAT_UINT64_T<uint64_t>, allocationFailuresWidth, info.m_allocationFailures, " |");
             wprintw(pad, FORMAT_UINT64_T<uint64_t>, chunkSizeWidth, info.m_chunkSize, " |");
             wprintw(pad, FORMAT_UINT64_T<uint64_t>, chunkPayloadSizeWidth, info.m_chunkPayloadSize, "\n");
         }